@@ -0,0 +1,87 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+
+#include <constraints/csp_solver.h>
+#include <constraints/utils/csp_batch_check.h>
+
+#include "bench_utils.h"
+
+using namespace CSP;
+
+// Checks per second of the batch kernels against one is_satisfied() per value
+int main() {
+    std::cout << "Benchmark batch constraint checks.." << std::endl;
+    std::cout << "Best SIMD level: " << (int)best_simd_level() << std::endl;
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> value(0, 1000);
+
+    const std::pair<Relation, std::string> relations[] = {
+        {Relation::Equal, "=="}, {Relation::NotEqual, "!="}, {Relation::Less, "<"}, {Relation::DistanceNotEqual, "|x-y| != k"}};
+
+    // 1. Raw kernels
+    for (std::size_t n: {16, 64, 1024})
+    {
+        std::vector<int> candidates(n);
+        for (int& c: candidates) c = value(rng);
+        std::vector<std::uint64_t> mask((n + 63) / 64);
+        const std::size_t checks = 50000000;
+        const std::size_t repetitions = checks / n;
+
+        for (auto& [relation, name]: relations)
+            for (SimdLevel level: {SimdLevel::Scalar, SimdLevel::SSE, SimdLevel::AVX2})
+            {
+                if (!simd_level_supported(level)) continue;
+                std::uint64_t sink = 0;
+                double us = bench::time_us([&]() {
+                    for (std::size_t r = 0; r < repetitions; r++)
+                    {
+                        std::fill(mask.begin(), mask.end(), 0);
+                        batch_compare(batch_op(relation, 1), (int)r & 1023, 3, candidates.data(), n, mask.data(), level);
+                        sink += mask[0];
+                    }
+                });
+                double rate = repetitions * n / us; // checks per microsecond
+                bench::report("n=" + std::to_string(n) + " " + name + " level " + std::to_string((int)level), us,
+                              std::to_string(rate) + " M checks/s (sink " + std::to_string(sink & 1) + ")");
+            }
+    }
+
+    // 2. One Assignment + is_satisfied per value, as the solvers did before
+    {
+        std::vector<int> candidates(64);
+        for (int& c: candidates) c = value(rng);
+        Constraint<int> lambda({0, 1}, [](std::vector<int> v) { return v.size() < 2 || v[0] != v[1]; });
+        const std::size_t repetitions = 20000;
+        std::uint64_t sink = 0;
+        double us = bench::time_us([&]() {
+            for (std::size_t r = 0; r < repetitions; r++)
+                for (int c: candidates)
+                {
+                    Assignment<int> assignment;
+                    assignment.assign(0, (int)r);
+                    assignment.assign(1, c);
+                    sink += lambda.is_satisfied(assignment);
+                }
+        });
+        bench::report("n=64 != is_satisfied per value", us, std::to_string(repetitions * 64 / us) + " M checks/s (sink " + std::to_string(sink & 1) + ")");
+    }
+
+    // 3. End to end: forward checking on N-Queens with lambda or relational constraints
+    for (int n: {12, 20})
+    {
+        for (bool relational: {false, true})
+        {
+            const CSProblem<int> model = bench::make_queens(n, relational);
+            CSPSolver<int> solver(CSPSrategy::ForwardChecking);
+            double us = bench::time_us([&]() { CSProblem<int> p = model; solver.solve(p); });
+            bench::report(std::to_string(n) + "-queens forward checking " + (relational ? "relational" : "lambda"), us,
+                          std::to_string(solver.getVisitedNodes()) + " nodes");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include <iostream>
+#include <cstdint>
+
+#include <constraints/csp_solver.h>
+#include <constraints/utils/csp_limits.h>
+
+#include "bench_utils.h"
+
+using namespace CSP;
+
+// Measures the cost of polling limits and cancellation during the search
+int main() {
+    std::cout << "Benchmark limits polling overhead.." << std::endl;
+
+    // 1. Raw cost of SearchMonitor::should_stop() in a tight loop
+    const std::uint64_t iterations = 100000000;
+    {
+        SearchMonitor monitor;
+        monitor.start(CSPLimits(), nullptr);
+        std::uint64_t stops = 0;
+        double us = bench::time_us([&]() {
+            for (std::uint64_t i = 0; i < iterations; i++) stops += monitor.should_stop();
+        });
+        bench::report("should_stop() without limits", us, std::to_string(us * 1000.0 / iterations) + " ns/call, " + std::to_string(stops) + " stops");
+    }
+    {
+        SearchMonitor monitor;
+        CancellationToken token;
+        CSPLimits limits;
+        limits.max_time = std::chrono::hours(1);
+        limits.max_nodes = iterations * 2;
+        limits.max_memory_bytes = (std::size_t)1 << 40;
+        monitor.start(limits, &token);
+        std::uint64_t stops = 0;
+        double us = bench::time_us([&]() {
+            for (std::uint64_t i = 0; i < iterations; i++) stops += monitor.should_stop();
+        });
+        bench::report("should_stop() with all limits and token", us, std::to_string(us * 1000.0 / iterations) + " ns/call, " + std::to_string(stops) + " stops");
+    }
+
+    // 2. End to end: sudoku solved without and with every limit armed
+    const int repetitions = 5;
+    for (auto strategy: {CSPSolver<int>::CSPSrategy::Backtracking, CSPSolver<int>::CSPSrategy::ForwardChecking})
+    {
+        std::string name = strategy == CSPSolver<int>::CSPSrategy::Backtracking ? "backtracking" : "forward checking";
+        const CSProblem<int> sudoku = bench::make_sudoku();
+
+        CSPSolver<int> free_solver(strategy);
+        double free_us = bench::time_us([&]() { CSProblem<int> p = sudoku; free_solver.solve(p); }, repetitions);
+
+        CSPSolver<int> limited_solver(strategy);
+        CancellationToken token;
+        CSPLimits limits;
+        limits.max_time = std::chrono::hours(1);
+        limits.max_nodes = UINT64_MAX / 2;
+        limits.max_memory_bytes = (std::size_t)1 << 40;
+        limited_solver.setLimits(limits);
+        limited_solver.setCancellationToken(&token);
+        double limited_us = bench::time_us([&]() { CSProblem<int> p = sudoku; limited_solver.solve(p); }, repetitions);
+
+        bench::report("sudoku " + name + " without limits", free_us, std::to_string(free_solver.getVisitedNodes()) + " nodes");
+        bench::report("sudoku " + name + " with limits", limited_us, std::to_string(limited_solver.getVisitedNodes()) + " nodes, overhead " + std::to_string(100.0 * (limited_us - free_us) / free_us) + "%");
+    }
+
+    return 0;
+}
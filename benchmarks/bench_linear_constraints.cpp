@@ -0,0 +1,108 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <constraints/csp_solver.h>
+
+#include "bench_utils.h"
+
+using namespace CSP;
+
+// Linear constraint written as a black-box rule: it can only be checked once every variable is assigned
+Constraint<int> as_lambda(std::vector<Variable> variables, std::vector<int> coefficients, LinearRelation relation, int constant)
+{
+    std::size_t arity = variables.size();
+    return Constraint<int>(variables, [=](std::vector<int> values) -> bool
+    {
+        if (values.size() < arity) return true;
+        int total = 0;
+        for (std::size_t i = 0; i < arity; i++) total += coefficients[i] * values[i];
+        if (relation == LinearRelation::LessEqual) return total <= constant;
+        if (relation == LinearRelation::GreaterEqual) return total >= constant;
+        return total == constant;
+    });
+}
+
+struct LinearModel
+{
+    int variables;
+    std::vector<int> domain;
+    std::vector<std::tuple<std::vector<int>, LinearRelation, int>> rows; // coefficients, relation, constant
+};
+
+CSProblem<int> build(const LinearModel& model, bool native)
+{
+    CSProblem<int> problem;
+    std::vector<Variable> variables;
+    for (int i = 0; i < model.variables; i++)
+    {
+        problem.addVariable(i, Domain<int>(model.domain));
+        variables.push_back(i);
+    }
+    for (auto& [coefficients, relation, constant]: model.rows)
+    {
+        if (native) problem.addLinearConstraint({variables, coefficients, relation, constant});
+        else problem.addConstraint(as_lambda(variables, coefficients, relation, constant));
+    }
+    return problem;
+}
+
+void compare(const std::string& name, const LinearModel& model, CSPSrategy strategy)
+{
+    CSPLimits limits;
+    limits.max_time = std::chrono::seconds(30);
+
+    for (bool native: {false, true})
+    {
+        CSPSolver<int> solver(strategy);
+        solver.setLimits(limits);
+        CSPResult result = CSPResult::UNKNOWN;
+        double us = bench::time_us([&]() { CSProblem<int> p = build(model, native); result = solver.solve(p); });
+        std::string outcome = result == CSPResult::SAT ? "SAT" : result == CSPResult::UNSAT ? "UNSAT" : "UNKNOWN";
+        bench::report(name + (native ? " linear constraints" : " lambda constraints"), us, outcome + ", " + std::to_string(solver.getVisitedNodes()) + " nodes");
+    }
+}
+
+// Best value reachable within the capacity (dynamic programming), used to build a tight instance
+int knapsack_optimum(const std::vector<int>& weights, const std::vector<int>& values, int capacity)
+{
+    std::vector<int> best(capacity + 1, 0);
+    for (std::size_t i = 0; i < weights.size(); i++)
+        for (int c = capacity; c >= weights[i]; c--)
+            best[c] = std::max(best[c], best[c - weights[i]] + values[i]);
+    return best[capacity];
+}
+
+// Pruning of native linear constraints against the same constraints written as lambdas
+int main() {
+    std::cout << "Benchmark linear constraints.." << std::endl;
+
+    // 1. 0/1 knapsack: weight <= capacity and value >= target
+    const std::vector<int> weights = {12, 7, 11, 8, 9, 6, 14, 5, 10, 13, 4, 15, 3, 16};
+    const std::vector<int> values = {24, 13, 23, 15, 16, 11, 28, 9, 19, 26, 7, 29, 5, 31};
+    const int capacity = 60;
+    const int optimum = knapsack_optimum(weights, values, capacity);
+
+    LinearModel knapsack_sat{(int)weights.size(), {1, 0}, {{weights, LinearRelation::LessEqual, capacity}, {values, LinearRelation::GreaterEqual, optimum}}};
+    LinearModel knapsack_unsat{(int)weights.size(), {1, 0}, {{weights, LinearRelation::LessEqual, capacity}, {values, LinearRelation::GreaterEqual, optimum + 1}}};
+
+    compare("knapsack (optimum) backtracking", knapsack_sat, CSPSrategy::Backtracking);
+    compare("knapsack (optimum) forward checking", knapsack_sat, CSPSrategy::ForwardChecking);
+    compare("knapsack (optimum + 1) backtracking", knapsack_unsat, CSPSrategy::Backtracking);
+    compare("knapsack (optimum + 1) forward checking", knapsack_unsat, CSPSrategy::ForwardChecking);
+
+    // 2. Capacity planning: units x_i in 0..4 for 7 projects, demand met exactly, budget and
+    //    per-team capacities not exceeded
+    LinearModel planning{7, {0, 1, 2, 3, 4}, {
+        {{1, 1, 1, 1, 1, 1, 1}, LinearRelation::Equal, 19},
+        {{5, 8, 3, 7, 6, 4, 9}, LinearRelation::LessEqual, 96},
+        {{1, 1, 1, 0, 0, 0, 0}, LinearRelation::LessEqual, 7},
+        {{0, 0, 0, 1, 1, 1, 1}, LinearRelation::LessEqual, 12},
+        {{2, 0, 1, 0, 3, 0, 1}, LinearRelation::GreaterEqual, 14}
+    }};
+
+    compare("capacity planning backtracking", planning, CSPSrategy::Backtracking);
+    compare("capacity planning forward checking", planning, CSPSrategy::ForwardChecking);
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+
+#include <constraints/csp_solver.h>
+
+#include "bench_utils.h"
+
+using namespace CSP;
+
+// Recursive backtracking/forward checking as implemented before CSPSearchEngine, kept as reference
+class RecursiveReference
+{
+public:
+    RecursiveReference(bool forward_checking):_forward_checking(forward_checking){};
+
+    bool solve(CSProblem<int>& problem)
+    {
+        nodes = 0;
+        return search(problem);
+    }
+
+    std::uint64_t nodes = 0;
+
+private:
+    bool _forward_checking;
+
+    bool isValidAssignment(const CSProblem<int>& problem, Variable v, int value)
+    {
+        std::unordered_map<Variable, int> singleAssignment = {{v, value}};
+        for (const Constraint<int>& c: problem.getConstraints())
+        {
+            Assignment<int> assignment = singleAssignment;
+            if(!c.has_variable(v)) continue;
+            std::unordered_map<Variable, int> currentState = problem.getCurrentState();
+            for(auto cv: c.getConstraintVariables())
+            {
+                if(!currentState.contains(cv)) continue;
+                if(!assignment.getVariables().contains(cv)) assignment.assign(cv, currentState[cv]);
+            }
+            if(!c.is_satisfied(assignment)) return false;
+        }
+        return true;
+    }
+
+    std::unordered_map<Variable, Domain<int>> forward_check(CSProblem<int>& problem, Variable v)
+    {
+        std::unordered_map<Variable, Domain<int>> original_domains = problem.getDomainsCopy();
+        for (const Constraint<int>& c: problem.getConstraints())
+        {
+            if(!c.has_variable(v)) continue;
+            std::unordered_map<Variable, int> currentState = problem.getCurrentState();
+            for(auto cv: c.getConstraintVariables())
+            {
+                if (cv == v) continue;
+                Domain<int>& domain = problem.getDomain(cv);
+                for (const Constraint<int>& c_: problem.getConstraints())
+                {
+                    if(!c_.has_variable(cv)) continue;
+                    std::vector<int> values = domain.get_values();
+                    for (int cv_value : values)
+                    {
+                        Assignment<int> assignment = std::unordered_map<Variable, int>{{cv, cv_value}};
+                        for(auto cvs: c_.getConstraintVariables())
+                        {
+                            if(!currentState.contains(cvs)) continue;
+                            if(!assignment.getVariables().contains(cvs)) assignment.assign(cvs, currentState[cvs]);
+                        }
+                        if(!c_.is_satisfied(assignment)) domain.remove(cv_value);
+                    }
+                }
+            }
+        }
+        return original_domains;
+    }
+
+    bool search(CSProblem<int>& problem)
+    {
+        if (problem.getUnassignedVariables().empty()) return true;
+        nodes++;
+
+        Variable variable = problem.getUnassignedVariables()[0];
+        Domain<int> domain = problem.getDomain(variable);
+        for (int value : domain.get_values())
+        {
+            if (!isValidAssignment(problem, variable, value)) continue;
+            problem.assignValue(variable, value);
+            if (_forward_checking)
+            {
+                auto original_domains = forward_check(problem, variable);
+                if (search(problem)) return true;
+                problem.setDomains(original_domains);
+            }
+            else if (search(problem)) return true;
+            problem.unassignValue(variable);
+        }
+        return false;
+    }
+};
+
+void compare(const std::string& name, const CSProblem<int>& model, bool forward_checking)
+{
+    RecursiveReference reference(forward_checking);
+    double recursive_us = bench::time_us([&]() { CSProblem<int> p = model; reference.solve(p); });
+
+    CSPSolver<int> solver(forward_checking ? CSPSolver<int>::CSPSrategy::ForwardChecking : CSPSolver<int>::CSPSrategy::Backtracking);
+    double engine_us = bench::time_us([&]() { CSProblem<int> p = model; solver.solve(p); });
+
+    double recursive_ns = 1000.0 * recursive_us / reference.nodes;
+    double engine_ns = 1000.0 * engine_us / solver.getVisitedNodes();
+    bench::report(name + " recursive", recursive_us, std::to_string(reference.nodes) + " nodes, " + std::to_string(recursive_ns) + " ns/node");
+    bench::report(name + " explicit stack", engine_us, std::to_string(solver.getVisitedNodes()) + " nodes, " + std::to_string(engine_ns) + " ns/node");
+}
+
+// Per-node cost of the explicit-stack engine against the recursive implementation
+int main() {
+    std::cout << "Benchmark search engine per-node overhead.." << std::endl;
+
+    compare("sudoku backtracking", bench::make_sudoku(), false);
+    compare("sudoku forward checking", bench::make_sudoku(), true);
+    compare("12-queens backtracking", bench::make_queens(12), false);
+    compare("12-queens forward checking", bench::make_queens(12), true);
+
+    return 0;
+}
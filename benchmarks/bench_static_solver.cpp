@@ -0,0 +1,52 @@
+#include <iostream>
+#include <array>
+#include <cstdlib>
+
+#include <constraints/csp_solver.h>
+#include <constraints/csp_static_models.h>
+#include <constraints/csp_static_solver.h>
+
+#include "bench_utils.h"
+
+using namespace CSP;
+
+CSPStaticProblem<StaticSudoku> make_static_sudoku()
+{
+    CSProblem<int> dynamic = bench::make_sudoku();
+    CSPStaticProblem<StaticSudoku> sudoku;
+    for (int i = 1; i <= 9; i++)
+        for (int j = 1; j <= 9; j++)
+            if (dynamic.isAssigned(i*10 + j)) sudoku.assignValue((i - 1) * 9 + (j - 1), dynamic.getValue(i*10 + j));
+    return sudoku;
+}
+
+template <typename Model>
+void compare(const std::string& name, const CSProblem<int>& dynamic_model, const CSPStaticProblem<Model>& static_model, CSPSrategy strategy)
+{
+    const int dynamic_repetitions = 5, static_repetitions = 2000;
+
+    CSPSolver<int> dynamic_solver(strategy);
+    double dynamic_us = bench::time_us([&]() { CSProblem<int> p = dynamic_model; dynamic_solver.solve(p); }, dynamic_repetitions);
+
+    CSPStaticSolver<Model> static_solver(strategy);
+    double static_us = bench::time_us([&]() { CSPStaticProblem<Model> p = static_model; static_solver.solve(p); }, static_repetitions);
+
+    bench::report(name + " dynamic", dynamic_us, std::to_string(1e6 / dynamic_us) + " solves/s");
+    bench::report(name + " static", static_us, std::to_string(1e6 / static_us) + " solves/s, speedup x" + std::to_string(dynamic_us / static_us));
+}
+
+// Throughput of CSPStaticSolver against CSPSolver on the same fixed-shape problems
+int main() {
+    std::cout << "Benchmark static solver against dynamic solver.." << std::endl;
+
+    const CSPStaticProblem<StaticSudoku> sudoku = make_static_sudoku();
+    const CSPStaticProblem<StaticQueens<12>> queens;
+
+    compare("sudoku backtracking", bench::make_sudoku(), sudoku, CSPSrategy::Backtracking);
+    compare("sudoku forward checking", bench::make_sudoku(), sudoku, CSPSrategy::ForwardChecking);
+    compare("sudoku forward checking + MRV", bench::make_sudoku(), sudoku, CSPSrategy::BacktrackingEuristics);
+    compare("12-queens backtracking", bench::make_queens(12), queens, CSPSrategy::Backtracking);
+    compare("12-queens forward checking", bench::make_queens(12), queens, CSPSrategy::ForwardChecking);
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include <unordered_set>
+
+#include <constraints/csp_problem.h>
+
+namespace bench
+{
+    // Run fn `repetitions` times and return the average time in microseconds
+    template <typename F>
+    double time_us(F&& fn, int repetitions = 1)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repetitions; r++) fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / repetitions;
+    }
+
+    inline void report(const std::string& name, double us, const std::string& extra = "")
+    {
+        std::cout << name << ": " << us << " us" << (extra.empty() ? "" : " (" + extra + ")") << std::endl;
+    }
+
+    // Sudoku used by the test suite: cell (i,j) is the variable i*10+j
+    inline CSP::CSProblem<int> make_sudoku()
+    {
+        using namespace CSP;
+
+        CSProblem<int> sudoku;
+        std::vector<int> domain_values = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+        for (int i = 1; i <= 9; i++)
+            for (int j = 1; j <= 9; j++)
+                sudoku.addVariable(i*10 + j, Domain<int>(domain_values));
+
+        const int givens[][2] = {
+            {13,2},{16,7},{22,6},{24,9},{26,3},{27,4},{32,9},{34,2},{35,5},{39,3},{44,4},{47,1},{51,7},
+            {52,3},{55,6},{63,9},{64,5},{65,3},{68,6},{73,6},{74,3},{75,4},{78,7},{81,8},{89,9},{98,5}
+        };
+        for (auto& g: givens) sudoku.assignValue(g[0], g[1]);
+
+        auto all_different_rule = [](std::vector<int> values) -> bool
+        {
+            std::unordered_set<int> uniqueValues(values.begin(), values.end());
+            return uniqueValues.size() == values.size();
+        };
+
+        for (int i = 1; i <= 9; i++)
+        {
+            std::vector<Variable> row, col;
+            for (int j = 1; j <= 9; j++)
+            {
+                row.push_back(i*10 + j);
+                col.push_back(j*10 + i);
+            }
+            sudoku.addConstraint({row, all_different_rule});
+            sudoku.addConstraint({col, all_different_rule});
+        }
+
+        const int square_ids[] = {11,14,17,41,44,47,71,74,77};
+        for (int k = 0; k < 9; k++)
+        {
+            std::vector<Variable> square;
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    square.push_back(square_ids[k] + 10*i + j);
+            sudoku.addConstraint({square, all_different_rule});
+        }
+
+        return sudoku;
+    }
+
+    // N-Queens: variable i is the column of the queen on row i. Each pair of rows has a
+    // different-column and a different-diagonal constraint, as lambdas or as relational constraints.
+    inline CSP::CSProblem<int> make_queens(int n, bool relational = false)
+    {
+        using namespace CSP;
+
+        CSProblem<int> problem;
+        std::vector<int> columns;
+        for (int c = 0; c < n; c++) columns.push_back(c);
+        for (int i = 0; i < n; i++) problem.addVariable(i, Domain<int>(columns));
+        for (int i = 0; i < n; i++)
+            for (int j = i + 1; j < n; j++)
+            {
+                int distance = j - i;
+                if (relational)
+                {
+                    problem.addConstraint(Constraint<int>::relational(i, j, Relation::NotEqual));
+                    problem.addConstraint(Constraint<int>::relational(i, j, Relation::DistanceNotEqual, distance));
+                }
+                else
+                {
+                    problem.addConstraint({{i, j}, [](std::vector<int> v) { return v.size() < 2 || v[0] != v[1]; }});
+                    problem.addConstraint({{i, j}, [distance](std::vector<int> v) { return v.size() < 2 || std::abs(v[0] - v[1]) != distance; }});
+                }
+            }
+        return problem;
+    }
+
+};
@@ -7,6 +7,7 @@
 #include <constraints/utils/csp_variable.h>
 #include <constraints/utils/csp_domain.h>
 #include <constraints/utils/csp_constraint.h>
+#include <constraints/utils/csp_linear_constraint.h>
 
 namespace CSP
 {
@@ -31,6 +32,7 @@ namespace CSP
             
             return it->second;
         }
+        const Domain<T>& getDomain(const Variable& v) const { return _domains.find(v)->second; }
 
         std::unordered_map<Variable, Domain<T>> getDomainsCopy()
         {            
@@ -43,9 +45,17 @@ namespace CSP
 
         const std::vector<Constraint<T>>& getConstraints() const {return _constraints;};
 
+        // Linear constraints are propagated on their bounds by the search strategies (T must be integral);
+        // ArcConsistency does not support them and solves such a problem as UNKNOWN
+        void addLinearConstraint(LinearConstraint<T> c) {_linear_constraints.push_back(std::move(c));}
+        const std::vector<LinearConstraint<T>>& getLinearConstraints() const {return _linear_constraints;};
+
         void assignValue(Variable variable, T value){ _state[variable] = value;}
         void unassignValue(Variable variable){ _state.erase(variable);}
 
+        bool isAssigned(const Variable& variable) const { return _state.contains(variable); }
+        const T& getValue(const Variable& variable) const { return _state.at(variable); }
+
         bool getSolution(std::unordered_map<Variable, T>* solution)
         {
             *solution = _state;
@@ -72,6 +82,7 @@ namespace CSP
         std::vector<Variable> _variables;
         std::unordered_map<Variable, Domain<T>> _domains;
         std::vector<Constraint<T>> _constraints;
+        std::vector<LinearConstraint<T>> _linear_constraints;
         
         std::unordered_map<Variable, T> _state;
 
@@ -0,0 +1,775 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <unordered_map>
+
+#include <constraints/csp_problem.h>
+#include <constraints/utils/csp_limits.h>
+#include <constraints/utils/csp_batch_check.h>
+
+namespace CSP
+{
+    // State of a search after a call to CSPSearchEngine::start()/run()
+    enum class SearchStatus
+    {
+        Solved,     // a complete assignment has been found (run() again to look for the next one)
+        Exhausted,  // the whole search space has been explored
+        Suspended   // stopped by the monitor, the search can be resumed or checkpointed
+    };
+
+    // Explicit-stack depth-first search used by the backtracking strategies.
+    // Each level of the search is a compact Frame; domain changes made by forward checking are
+    // saved on a trail and undone when the level is left, so the search can be stopped at any
+    // node, resumed later, or saved to disk and reloaded.
+    // Linear constraints keep the minimum and maximum of their sum over the current bounds of
+    // their variables; every bound change (assignment, pruning, undo) updates them in O(1) per
+    // constraint, and they are used to reject values early and, with forward checking, to prune
+    // the domains of the other variables.
+    template <typename T>
+    class CSPSearchEngine
+    {
+    public:
+        struct Options
+        {
+            bool forward_checking = false;
+            bool minimum_remaining_values = false; // MRV variable ordering instead of the declaration order
+        };
+
+        CSPSearchEngine():_status(SearchStatus::Exhausted){};
+        CSPSearchEngine(Options options):_options(options), _status(SearchStatus::Exhausted){};
+
+        // Start a new search on the current state of problem
+        SearchStatus start(CSProblem<T>& problem, SearchMonitor& monitor)
+        {
+            build(problem);
+
+            // 0. Filter the domains against the values already assigned in the problem
+            if (!propagate_initial(problem))
+            {
+                undo(0);
+                return _status = SearchStatus::Exhausted;
+            }
+
+            std::size_t root = select_variable(0);
+            if (root == npos)
+                return _status = SearchStatus::Solved;
+
+            _stack.push_back({root, 0, _trail.size()});
+            if (monitor.should_stop(memory_usage()))
+                return _status = SearchStatus::Suspended;
+
+            return run(problem, monitor);
+        }
+
+        // Continue the search from the current stack (after a suspension or a previous solution)
+        SearchStatus run(CSProblem<T>& problem, SearchMonitor& monitor)
+        {
+            bind_domains(problem);
+
+            while (!_stack.empty())
+            {
+                Frame& frame = _stack.back();
+                const Variable& variable = _variables[frame.variable];
+
+                // 1. Revert the value previously tried at this level
+                if (_assigned[frame.variable])
+                {
+                    problem.unassignValue(variable);
+                    _assigned[frame.variable] = false;
+                    refresh_bounds(frame.variable);
+                }
+                undo(frame.trail_mark);
+
+                // 2. No more values: go back to the previous level
+                const std::vector<T>& values = _domains[frame.variable]->get_values();
+                if (frame.value_index >= values.size())
+                {
+                    _stack.pop_back();
+                    continue;
+                }
+
+                // 3. Try the next value of the domain
+                T value = values[frame.value_index++];
+                if (!is_consistent(problem, frame.variable, value))
+                    continue;
+
+                problem.assignValue(variable, value);
+                _assigned[frame.variable] = true;
+                set_bounds(frame.variable, value, value);
+                if (_options.forward_checking && !propagate_assignment(problem, frame.variable))
+                    continue;
+
+                // 4. Go deeper, or stop if every variable has a value
+                std::size_t next = select_variable(frame.variable + 1);
+                if (next == npos)
+                    return _status = SearchStatus::Solved;
+
+                _stack.push_back({next, 0, _trail.size()});
+                if (monitor.should_stop(memory_usage()))
+                    return _status = SearchStatus::Suspended;
+            }
+
+            undo(0);
+            return _status = SearchStatus::Exhausted;
+        }
+
+        SearchStatus status() const { return _status; }
+        std::size_t depth() const { return _stack.size(); }
+
+        // Memory held by the search (stack, trail and saved domains), kept up to date in O(1)
+        std::size_t memory_usage() const
+        {
+            return _stack.capacity() * sizeof(Frame) + _trail.capacity() * sizeof(TrailEntry) + _trail_bytes;
+        }
+
+        // Write the in-progress search to a file (values are written with operator<<, floating
+        // point values with enough digits to be read back exactly). Domains and values are read
+        // from problem, which must be in the state of the search (the solved instance or a copy).
+        bool save_checkpoint(const std::string& path, const CSProblem<T>& problem) const
+        {
+            if (problem.getVariables() != _variables) return false;
+            for (std::size_t p = 0; p < _variables.size(); p++)
+                if (problem.isAssigned(_variables[p]) != _assigned[p]) return false;
+
+            std::ofstream out(path);
+            if (!out) return false;
+            if constexpr (std::is_floating_point_v<T>)
+                out << std::setprecision(std::numeric_limits<T>::max_digits10);
+
+            out << checkpoint_header << "\n";
+            out << "options " << _options.forward_checking << " " << _options.minimum_remaining_values << "\n";
+            out << "status " << (int)_status << "\n";
+
+            out << "variables " << _variables.size() << "\n";
+            for (const Variable& v: _variables) out << v.get_id() << " ";
+            out << "\n";
+
+            out << "assigned " << std::count(_assigned.begin(), _assigned.end(), true) << "\n";
+            for (std::size_t p = 0; p < _variables.size(); p++)
+            {
+                if (!_assigned[p]) continue;
+                out << p << " " << problem.getValue(_variables[p]) << "\n";
+            }
+
+            out << "domains\n";
+            for (std::size_t p = 0; p < _variables.size(); p++)
+                write_values(out, problem.getDomain(_variables[p]).get_values());
+
+            out << "stack " << _stack.size() << "\n";
+            for (const Frame& f: _stack) out << f.variable << " " << f.value_index << " " << f.trail_mark << "\n";
+
+            out << "trail " << _trail.size() << "\n";
+            for (const TrailEntry& e: _trail)
+            {
+                out << e.variable << " ";
+                write_values(out, e.values);
+            }
+
+            return (bool)out;
+        }
+
+        // Restore a search saved by save_checkpoint(). problem must be built with the same model
+        // (variables and constraints) used when the checkpoint was written. The whole file is
+        // parsed before anything is changed: on a malformed file the engine and problem are untouched.
+        bool load_checkpoint(const std::string& path, CSProblem<T>& problem)
+        {
+            std::ifstream in(path);
+            if (!in) return false;
+
+            std::string header;
+            std::getline(in, header);
+            if (header != checkpoint_header) return false;
+
+            // 1. Parse the checkpoint
+            bool fc = false, mrv = false;
+            int status = 0;
+            if (!expect(in, "options") || !(in >> fc >> mrv) || fc != _options.forward_checking || mrv != _options.minimum_remaining_values) return false;
+            if (!expect(in, "status") || !(in >> status) || status < (int)SearchStatus::Solved || status > (int)SearchStatus::Suspended) return false;
+
+            // The checkpoint must describe the same variables, in the same order
+            const std::vector<Variable> variables = problem.getVariables();
+            const std::size_t n = variables.size();
+            std::size_t count = 0;
+            if (!expect(in, "variables") || !(in >> count) || count != n) return false;
+            for (std::size_t p = 0; p < n; p++)
+            {
+                int id;
+                if (!(in >> id) || id != variables[p].get_id()) return false;
+            }
+
+            std::vector<std::pair<std::size_t, T>> assignment;
+            if (!expect(in, "assigned") || !(in >> count) || count > n) return false;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                std::size_t p = 0;
+                T value;
+                if (!(in >> p) || p >= n || !(in >> value)) return false;
+                assignment.push_back({p, std::move(value)});
+            }
+
+            if (!expect(in, "domains")) return false;
+            std::vector<std::vector<T>> domains(n);
+            for (std::vector<T>& values: domains)
+                if (!read_values(in, values)) return false;
+
+            // A level is pushed for each variable at most, the trail grows while reading
+            std::vector<Frame> stack;
+            if (!expect(in, "stack") || !(in >> count) || count > n) return false;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                Frame f;
+                if (!(in >> f.variable >> f.value_index >> f.trail_mark) || f.variable >= n) return false;
+                stack.push_back(f);
+            }
+
+            std::vector<TrailEntry> trail;
+            if (!expect(in, "trail") || !(in >> count)) return false;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                TrailEntry e;
+                if (!(in >> e.variable) || e.variable >= n || !read_values(in, e.values)) return false;
+                trail.push_back(std::move(e));
+            }
+            for (const Frame& f: stack)
+                if (f.trail_mark > trail.size()) return false;
+
+            // 2. Restore the search
+            build(problem);
+            for (std::size_t p = 0; p < n; p++)
+            {
+                problem.unassignValue(_variables[p]);
+                _assigned[p] = false;
+            }
+            for (auto& [p, value]: assignment)
+            {
+                problem.assignValue(_variables[p], value);
+                _assigned[p] = true;
+            }
+            for (std::size_t p = 0; p < n; p++)
+                _domains[p]->set(std::move(domains[p]));
+
+            _stack = std::move(stack);
+            _trail = std::move(trail);
+            for (const TrailEntry& e: _trail) _trail_bytes += e.values.size() * sizeof(T);
+
+            init_linear(problem);
+            _status = (SearchStatus)status;
+            return true;
+        }
+
+    private:
+        static constexpr std::size_t npos = (std::size_t)-1;
+        static constexpr const char* checkpoint_header = "algoai-csp-checkpoint 1";
+
+        // One level of the search: variable (position in the problem variables), next value to try
+        // and size of the trail before the level made any change
+        struct Frame
+        {
+            std::size_t variable;
+            std::size_t value_index;
+            std::size_t trail_mark;
+        };
+
+        // Domain of a variable as it was before being reduced
+        struct TrailEntry
+        {
+            std::size_t variable;
+            std::vector<T> values;
+        };
+
+        Options _options;
+        SearchStatus _status;
+
+        std::vector<Variable> _variables;
+        std::unordered_map<Variable, std::size_t> _positions;
+        std::vector<Domain<T>*> _domains;
+        std::vector<bool> _assigned;
+
+        const std::vector<Constraint<T>>* _constraints = nullptr;
+        std::vector<std::vector<std::size_t>> _scopes;          // variables of each constraint
+        std::vector<std::vector<std::size_t>> _constraints_of;  // constraints of each variable
+
+        // Binary relations (only used when T is arithmetic) and linear constraints (T integral)
+        static constexpr bool relations_enabled = std::is_arithmetic_v<T>;
+        static constexpr bool linear_enabled = std::is_integral_v<T>;
+        using Sum = long long;
+
+        struct LinearTerm
+        {
+            std::size_t index;  // constraint for _linear_of, variable for _linear_scopes
+            Sum coefficient;
+        };
+
+        std::vector<std::vector<LinearTerm>> _linear_scopes;    // variables of each linear constraint
+        std::vector<std::vector<LinearTerm>> _linear_of;        // linear constraints of each variable
+        std::vector<LinearRelation> _linear_relations;
+        std::vector<Sum> _linear_constants;
+        std::vector<Sum> _min_sums, _max_sums;
+        std::vector<Sum> _lower, _upper;                        // bounds of each variable used by the sums
+        std::vector<std::size_t> _linear_queue;
+        std::vector<bool> _linear_queued;
+
+        SupportMask _mask;  // buffer of the batch checks
+
+        std::vector<Frame> _stack;
+        std::vector<TrailEntry> _trail;
+        std::size_t _trail_bytes = 0;   // values of the domains saved on the trail
+        std::vector<std::uint64_t> _saved_stamp;
+        std::uint64_t _stamp = 0;
+
+        // Index the problem once, so that each node works on positions instead of hashing variables
+        void build(CSProblem<T>& problem)
+        {
+            _variables = problem.getVariables();
+            const std::size_t n = _variables.size();
+
+            _positions.clear();
+            _assigned.assign(n, false);
+            for (std::size_t p = 0; p < n; p++)
+            {
+                _positions[_variables[p]] = p;
+                _assigned[p] = problem.isAssigned(_variables[p]);
+            }
+
+            _constraints = &problem.getConstraints();
+            _scopes.assign(_constraints->size(), {});
+            _constraints_of.assign(n, {});
+            for (std::size_t c = 0; c < _constraints->size(); c++)
+            {
+                for (const Variable& v: (*_constraints)[c].getConstraintVariables())
+                {
+                    auto it = _positions.find(v);
+                    if (it == _positions.end()) continue;
+                    _scopes[c].push_back(it->second);
+                    _constraints_of[it->second].push_back(c);
+                }
+            }
+
+            _stack.clear();
+            _trail.clear();
+            _trail_bytes = 0;
+            _saved_stamp.assign(n, 0);
+            _stamp = 0;
+
+            bind_domains(problem);
+
+            _linear_scopes.clear();
+            _linear_of.assign(n, {});
+            _linear_relations.clear();
+            _linear_constants.clear();
+            if constexpr (linear_enabled)
+            {
+                for (const LinearConstraint<T>& c: problem.getLinearConstraints())
+                {
+                    std::size_t index = _linear_scopes.size();
+                    _linear_scopes.push_back({});
+                    _linear_relations.push_back(c.getRelation());
+                    _linear_constants.push_back((Sum)c.getConstant());
+
+                    // A variable repeated in the sum is one term with the sum of its coefficients,
+                    // otherwise each occurrence would be relaxed on its own bounds
+                    std::vector<LinearTerm>& scope = _linear_scopes[index];
+                    for (std::size_t i = 0; i < c.getConstraintVariables().size(); i++)
+                    {
+                        auto it = _positions.find(c.getConstraintVariables()[i]);
+                        if (it == _positions.end()) continue;
+                        Sum coefficient = (Sum)c.getCoefficients()[i];
+                        auto term = std::find_if(scope.begin(), scope.end(), [&](const LinearTerm& t) { return t.index == it->second; });
+                        if (term != scope.end()) term->coefficient += coefficient;
+                        else scope.push_back({it->second, coefficient});
+                    }
+                    for (const LinearTerm& term: scope)
+                        _linear_of[term.index].push_back({index, term.coefficient});
+                }
+            }
+            init_linear(problem);
+        }
+
+        // Compute the bounds of the variables and the sums of the linear constraints from scratch
+        void init_linear(const CSProblem<T>& problem)
+        {
+            const std::size_t m = _linear_scopes.size();
+            _min_sums.assign(m, 0);
+            _max_sums.assign(m, 0);
+            _linear_queue.clear();
+            _linear_queued.assign(m, false);
+            _lower.assign(_variables.size(), 0);
+            _upper.assign(_variables.size(), 0);
+
+            if constexpr (linear_enabled)
+            {
+                for (std::size_t p = 0; p < _variables.size(); p++)
+                {
+                    if (_linear_of[p].empty()) continue;
+                    if (_assigned[p]) _lower[p] = _upper[p] = (Sum)problem.getValue(_variables[p]);
+                    else domain_bounds(p, _lower[p], _upper[p]);
+                    for (const LinearTerm& term: _linear_of[p])
+                    {
+                        _min_sums[term.index] += std::min(term.coefficient * _lower[p], term.coefficient * _upper[p]);
+                        _max_sums[term.index] += std::max(term.coefficient * _lower[p], term.coefficient * _upper[p]);
+                    }
+                }
+            }
+        }
+
+        void bind_domains(CSProblem<T>& problem)
+        {
+            _domains.resize(_variables.size());
+            for (std::size_t p = 0; p < _variables.size(); p++)
+                _domains[p] = &problem.getDomain(_variables[p]);
+            _constraints = &problem.getConstraints();
+        }
+
+        std::size_t select_variable(std::size_t from) const
+        {
+            if (!_options.minimum_remaining_values)
+            {
+                // Every variable before the current one is assigned: keep scanning forward
+                for (std::size_t p = from; p < _variables.size(); p++)
+                    if (!_assigned[p]) return p;
+                return npos;
+            }
+
+            std::size_t best = npos;
+            for (std::size_t p = 0; p < _variables.size(); p++)
+            {
+                if (_assigned[p]) continue;
+                if (best == npos || _domains[p]->get_values().size() < _domains[best]->get_values().size())
+                    best = p;
+            }
+            return best;
+        }
+
+        // Check constraint c with variable p set to value and the assigned variables of its scope
+        bool check(const CSProblem<T>& problem, std::size_t c, std::size_t p, const T& value) const
+        {
+            // Binary relational constraints are evaluated directly, without building an Assignment
+            if constexpr (relations_enabled)
+            {
+                std::size_t other = 0;
+                if (const BinaryRelation<T>* relation = binary_relation(c, p, other))
+                {
+                    if (!_assigned[_scopes[c][other]]) return true;
+                    const T& fixed = problem.getValue(_variables[_scopes[c][other]]);
+                    return other == 1 ? relation_holds(relation->relation, value, fixed, relation->k)
+                                      : relation_holds(relation->relation, fixed, value, relation->k);
+                }
+            }
+
+            Assignment<T> assignment;
+            for (std::size_t q: _scopes[c])
+            {
+                if (q == p) assignment.assign(_variables[q], value);
+                else if (_assigned[q]) assignment.assign(_variables[q], problem.getValue(_variables[q]));
+            }
+            return (*_constraints)[c].is_satisfied(assignment);
+        }
+
+        // Relation of constraint c if it is a binary relational constraint on p; other is the position of the other variable
+        const BinaryRelation<T>* binary_relation(std::size_t c, std::size_t p, std::size_t& other) const
+        {
+            const auto& relation = (*_constraints)[c].getRelation();
+            if (!relation || _scopes[c].size() != 2 || _scopes[c][0] == _scopes[c][1]) return nullptr;
+            other = _scopes[c][0] == p ? 1 : 0;
+            return &*relation;
+        }
+
+        bool is_consistent(const CSProblem<T>& problem, std::size_t p, const T& value) const
+        {
+            if constexpr (linear_enabled)
+            {
+                // The sums of the linear constraints must stay feasible with p = value
+                for (const LinearTerm& term: _linear_of[p])
+                {
+                    Sum contribution = term.coefficient * (Sum)value;
+                    Sum min_sum = _min_sums[term.index] - std::min(term.coefficient * _lower[p], term.coefficient * _upper[p]) + contribution;
+                    Sum max_sum = _max_sums[term.index] - std::max(term.coefficient * _lower[p], term.coefficient * _upper[p]) + contribution;
+                    if (!linear_feasible(term.index, min_sum, max_sum)) return false;
+                }
+            }
+
+            for (std::size_t c: _constraints_of[p])
+                if (!check(problem, c, p, value)) return false;
+            return true;
+        }
+
+        bool linear_feasible(std::size_t c, Sum min_sum, Sum max_sum) const
+        {
+            switch (_linear_relations[c])
+            {
+                case LinearRelation::LessEqual: return min_sum <= _linear_constants[c];
+                case LinearRelation::Equal: return min_sum <= _linear_constants[c] && max_sum >= _linear_constants[c];
+                case LinearRelation::GreaterEqual: return max_sum >= _linear_constants[c];
+            }
+            return false;
+        }
+
+        // Minimum and maximum of the current domain of p
+        void domain_bounds(std::size_t p, Sum& lower, Sum& upper) const
+        {
+            const std::vector<T>& values = _domains[p]->get_values();
+            if (values.empty()) return;
+            auto [min, max] = std::minmax_element(values.begin(), values.end());
+            lower = (Sum)*min;
+            upper = (Sum)*max;
+        }
+
+        // Update the sums of the linear constraints of p for its new bounds; returns true if they changed
+        bool set_bounds(std::size_t p, const T& lower_value, const T& upper_value)
+        {
+            if constexpr (linear_enabled)
+            {
+                Sum lower = (Sum)lower_value, upper = (Sum)upper_value;
+                if (_linear_of[p].empty() || (lower == _lower[p] && upper == _upper[p])) return false;
+
+                for (const LinearTerm& term: _linear_of[p])
+                {
+                    _min_sums[term.index] += std::min(term.coefficient * lower, term.coefficient * upper)
+                                           - std::min(term.coefficient * _lower[p], term.coefficient * _upper[p]);
+                    _max_sums[term.index] += std::max(term.coefficient * lower, term.coefficient * upper)
+                                           - std::max(term.coefficient * _lower[p], term.coefficient * _upper[p]);
+                }
+                _lower[p] = lower;
+                _upper[p] = upper;
+                return true;
+            }
+            return false;
+        }
+
+        // Bounds of an unassigned variable follow its domain (an empty domain keeps the last bounds)
+        bool refresh_bounds(std::size_t p)
+        {
+            if constexpr (linear_enabled)
+            {
+                if (_linear_of[p].empty() || _domains[p]->get_values().empty()) return false;
+                const std::vector<T>& values = _domains[p]->get_values();
+                auto [min, max] = std::minmax_element(values.begin(), values.end());
+                return set_bounds(p, *min, *max);
+            }
+            return false;
+        }
+
+        void enqueue_linear(std::size_t p)
+        {
+            for (const LinearTerm& term: _linear_of[p])
+            {
+                if (_linear_queued[term.index]) continue;
+                _linear_queued[term.index] = true;
+                _linear_queue.push_back(term.index);
+            }
+        }
+
+        // Bounds propagation of the queued linear constraints until nothing changes.
+        // A value v of x (coefficient w) is kept only if w*v can be reached without breaking the sum:
+        //   sum <= C: w*v - min(w*x) <= C - min_sum        sum >= C: max(w*x) - w*v <= max_sum - C
+        bool propagate_linear()
+        {
+            if constexpr (linear_enabled)
+            {
+                while (!_linear_queue.empty())
+                {
+                    std::size_t c = _linear_queue.back();
+                    _linear_queue.pop_back();
+                    _linear_queued[c] = false;
+
+                    if (!linear_feasible(c, _min_sums[c], _max_sums[c]))
+                    {
+                        clear_linear_queue();
+                        return false;
+                    }
+
+                    const LinearRelation relation = _linear_relations[c];
+                    for (const LinearTerm& term: _linear_scopes[c])
+                    {
+                        std::size_t q = term.index;
+                        if (_assigned[q]) continue;
+
+                        const Sum w = term.coefficient;
+                        const Sum min_contribution = std::min(w * _lower[q], w * _upper[q]);
+                        const Sum max_contribution = std::max(w * _lower[q], w * _upper[q]);
+                        const Sum upper_slack = _linear_constants[c] - _min_sums[c];
+                        const Sum lower_slack = _max_sums[c] - _linear_constants[c];
+                        const bool check_upper = relation != LinearRelation::GreaterEqual;
+                        const bool check_lower = relation != LinearRelation::LessEqual;
+
+                        const std::vector<T>& values = _domains[q]->get_values();
+                        std::vector<T> kept;
+                        kept.reserve(values.size());
+                        for (const T& value: values)
+                        {
+                            Sum contribution = w * (Sum)value;
+                            if (check_upper && contribution - min_contribution > upper_slack) continue;
+                            if (check_lower && max_contribution - contribution > lower_slack) continue;
+                            kept.push_back(value);
+                        }
+
+                        if (kept.size() == values.size()) continue;
+                        save_domain(q);
+                        _domains[q]->set(std::move(kept));
+                        if (_domains[q]->get_values().empty())
+                        {
+                            clear_linear_queue();
+                            return false;
+                        }
+                        if (refresh_bounds(q)) enqueue_linear(q);
+                    }
+                }
+            }
+            return true;
+        }
+
+        void clear_linear_queue()
+        {
+            for (std::size_t c: _linear_queue) _linear_queued[c] = false;
+            _linear_queue.clear();
+        }
+
+        // Remove from the unassigned variables of constraint c the values not compatible with the
+        // current assignment. Returns false if a domain becomes empty.
+        bool propagate_constraint(const CSProblem<T>& problem, std::size_t c)
+        {
+            for (std::size_t q: _scopes[c])
+            {
+                if (_assigned[q]) continue;
+
+                const std::vector<T>& values = _domains[q]->get_values();
+                std::vector<T> kept;
+                kept.reserve(values.size());
+
+                // Binary relational constraint with the other variable assigned: check the whole domain at once
+                bool batched = false;
+                if constexpr (relations_enabled)
+                {
+                    std::size_t other = 0;
+                    const BinaryRelation<T>* relation = binary_relation(c, q, other);
+                    if (relation && _assigned[_scopes[c][other]])
+                    {
+                        batch_support(*relation, 1 - other, problem.getValue(_variables[_scopes[c][other]]), values, _mask);
+                        for (std::size_t i = 0; i < values.size(); i++)
+                            if (is_supported(_mask, i)) kept.push_back(values[i]);
+                        batched = true;
+                    }
+                }
+                if (!batched)
+                {
+                    for (const T& value: values)
+                        if (check(problem, c, q, value)) kept.push_back(value);
+                }
+
+                if (kept.size() == values.size()) continue;
+                save_domain(q);
+                _domains[q]->set(std::move(kept));
+                if (_domains[q]->get_values().empty()) return false;
+                if (refresh_bounds(q)) enqueue_linear(q);
+            }
+            return true;
+        }
+
+        bool propagate_assignment(const CSProblem<T>& problem, std::size_t p)
+        {
+            ++_stamp;
+            enqueue_linear(p);
+            for (std::size_t c: _constraints_of[p])
+            {
+                if (!propagate_constraint(problem, c))
+                {
+                    clear_linear_queue();
+                    return false;
+                }
+            }
+            return propagate_linear();
+        }
+
+        bool propagate_initial(const CSProblem<T>& problem)
+        {
+            // Constraints between values already assigned in the problem are never reached by the search
+            for (std::size_t p = 0; p < _variables.size(); p++)
+                if (_assigned[p] && !is_consistent(problem, p, problem.getValue(_variables[p]))) return false;
+
+            // Without forward checking the linear constraints are only checked on the initial bounds
+            if (!_options.forward_checking)
+            {
+                for (std::size_t c = 0; c < _linear_scopes.size(); c++)
+                    if (!linear_feasible(c, _min_sums[c], _max_sums[c])) return false;
+                return true;
+            }
+
+            ++_stamp;
+            for (std::size_t c = 0; c < _linear_scopes.size(); c++)
+            {
+                _linear_queued[c] = true;
+                _linear_queue.push_back(c);
+            }
+            for (std::size_t c = 0; c < _scopes.size(); c++)
+            {
+                bool has_assigned = false;
+                for (std::size_t q: _scopes[c]) has_assigned |= _assigned[q];
+                if (has_assigned && !propagate_constraint(problem, c))
+                {
+                    clear_linear_queue();
+                    return false;
+                }
+            }
+            return propagate_linear();
+        }
+
+        // Save a domain on the trail the first time it is reduced by the current propagation
+        void save_domain(std::size_t p)
+        {
+            if (_saved_stamp[p] == _stamp) return;
+            _saved_stamp[p] = _stamp;
+            _trail.push_back({p, _domains[p]->get_values()});
+            _trail_bytes += _trail.back().values.size() * sizeof(T);
+        }
+
+        void undo(std::size_t mark)
+        {
+            while (_trail.size() > mark)
+            {
+                TrailEntry& entry = _trail.back();
+                _trail_bytes -= entry.values.size() * sizeof(T);
+                _domains[entry.variable]->set(std::move(entry.values));
+                if (!_assigned[entry.variable]) refresh_bounds(entry.variable);
+                _trail.pop_back();
+            }
+        }
+
+        static void write_values(std::ostream& out, const std::vector<T>& values)
+        {
+            out << values.size();
+            for (const T& value: values) out << " " << value;
+            out << "\n";
+        }
+
+        // Values grow while reading, so a corrupted size fails on the missing values instead of allocating
+        static bool read_values(std::istream& in, std::vector<T>& values)
+        {
+            std::size_t size = 0;
+            if (!(in >> size)) return false;
+            values.clear();
+            for (std::size_t i = 0; i < size; i++)
+            {
+                T value;
+                if (!(in >> value)) return false;
+                values.push_back(std::move(value));
+            }
+            return true;
+        }
+
+        static bool expect(std::istream& in, const char* keyword)
+        {
+            std::string token;
+            return (in >> token) && token == keyword;
+        }
+    };
+
+};
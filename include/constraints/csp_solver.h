@@ -4,10 +4,17 @@
 #include <algorithm>
 #include <unordered_map>
 #include <chrono>
+#include <string>
+#include <iostream>
+#include <type_traits>
 
 #include <constraints/csp_problem.h>
 #include <constraints/csp_binary_problem.h>
+#include <constraints/csp_search_engine.h>
 #include <constraints/utils/csp_domain.h>
+#include <constraints/utils/csp_limits.h>
+#include <constraints/utils/csp_strategy.h>
+#include <constraints/utils/csp_batch_check.h>
 
 namespace CSP
 {
@@ -17,213 +24,126 @@ namespace CSP
     {
 
     public:
-        enum class CSPSrategy
-        {
-            Backtracking,
-            BacktrackingEuristics,
-            ForwardChecking,
-            ArcConsistency //(AC-3)
-            // Local Search con Propagazione di Vincoli (Min-Conflicts)
-            // Algoritmo di Ricerca con Backjumping
-            // Tecniche di Propagazione di Vincoli Avanzate (e.g., Constraint Propagation)
-        };
-
+        using CSPSrategy = CSP::CSPSrategy;
 
-        CSPSolver(CSPSrategy s):_strategy(s), _enable_chrono(false){};
+        CSPSolver(CSPSrategy s):_strategy(s), _enable_chrono(false), _token(nullptr), _search_started(false){};
         ~CSPSolver(){};
 
-        bool solve(CSProblem<T>& problem)
+        // Returns SAT/UNSAT when the search completed, UNKNOWN when it has been stopped by a limit or a cancellation
+        // (or when ArcConsistency is used on a problem with linear constraints)
+        CSPResult solve(CSProblem<T>& problem)
         {
             bool problem_solved = false;
 
             if(_enable_chrono) _start = std::chrono::high_resolution_clock::now();
+            _monitor.start(_limits, _token);
 
             switch (_strategy)
             {
                 case CSPSrategy::Backtracking:
-                    problem_solved = backtracking(problem);
-                    break;
                 case CSPSrategy::ForwardChecking:
-                    problem_solved = backtracking_forward_checking(problem);
-                    break;
                 case CSPSrategy::BacktrackingEuristics:
-                    problem_solved = backtracking_with_euristics(problem);
+                    _engine = CSPSearchEngine<T>(engine_options());
+                    _search_started = true;
+                    problem_solved = _engine.start(problem, _monitor) == SearchStatus::Solved;
                     break;
                 case CSPSrategy::ArcConsistency:
+                    // Linear constraints are not enforced by arc consistency: the result would not be reliable
+                    if (!problem.getLinearConstraints().empty())
+                    {
+                        finish(problem, false);
+                        return CSPResult::UNKNOWN;
+                    }
                     problem_solved = arc_consistency((CSPBinaryProblem<T>&)problem);
                     break;
                 default:
                     problem_solved = false;
                     break;
             }
-            
-            if(_enable_chrono) 
-            {
-                _end = std::chrono::high_resolution_clock::now();
-                int duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(_end - _start).count();
-                std::cout << "Execution time: " << duration_ms << " ms" << std::endl;
-            }
-            problem.set_solved(problem_solved);
-            return problem_solved;
-        }
-
-        void _enableChrono(bool enabled=true) {_enable_chrono = enabled;}
-
-    private: 
-        CSPSrategy _strategy;
 
-        bool _enable_chrono;
-        std::chrono::high_resolution_clock::time_point _start, _end;
-
-        // Utility solver methods
+            return finish(problem, problem_solved);
+        }
 
-        // Remove value from incompatible domains
-        std::unordered_map<Variable, Domain<T>> forward_check(CSProblem<T>& problem, Variable v, T value)
+        // Continue a search stopped by a limit or a cancellation (or look for the next solution after SAT).
+        // Only available for the search strategies; the limits are re-armed for the resumed run.
+        // Returns UNKNOWN if no search has been started by solve() or loadCheckpoint().
+        CSPResult resume(CSProblem<T>& problem)
         {
-            std::unordered_map<Variable, Domain<T>> original_domains = problem.getDomainsCopy();
-            // 1. For each problem constraint
-            for (Constraint<T> c: problem.getConstraints())
-            {
-                // 2. If variable v is involved on constraint
-                if(!c.has_variable(v)) continue;
-                // 3. Remove value from domain of other involved variables if c is not satisfied
-                std::unordered_map<Variable, T> currentState = problem.getCurrentState();
-                for(auto cv: c.getConstraintVariables())
-                {
-                    if (cv !=v) 
-                    {
-                        // 4. Try assign remaining value of cv domain and check constraint
-                        Domain<T>& domain = problem.getDomain(cv);
-                        for (Constraint<T> c_: problem.getConstraints())
-                        {
-                            if(!c_.has_variable(cv)) continue;
-
-                            for (const T& cv_value : domain.get_values())
-                            {
-                                std::unordered_map<Variable, T> singleAssignment = {{cv, cv_value}};
-                                Assignment assignment = singleAssignment;
-                                //Fill the assignment with missing variables
-                                for(auto cvs: c_.getConstraintVariables())
-                                {
-                                    // If the value is not assigned yet, consider as a valid assignment
-                                    if(!currentState.contains(cvs)) continue;
-                                    if(!assignment.getVariables().contains(cvs)) assignment.assign(cvs, currentState[cvs]);
-                                }
-                                // Check if the assignment is satisfied
-                                if(!c_.is_satisfied(assignment)) 
-                                    problem.getDomain(cv).remove(cv_value);
-                            }
-                        }
+            if (_strategy == CSPSrategy::ArcConsistency || !_search_started) return CSPResult::UNKNOWN;
 
-                    }
-                }
-            }
+            if(_enable_chrono) _start = std::chrono::high_resolution_clock::now();
+            _monitor.resume(_limits, _token);
 
-            return original_domains;
+            return finish(problem, _engine.run(problem, _monitor) == SearchStatus::Solved);
         }
 
-        void revert_forward_check(CSProblem<T>& problem, std::unordered_map<Variable, Domain<T>> domains)
+        // Save/restore an in-progress search; the problem passed to saveCheckpoint must be the solved
+        // instance or a copy of it, the one passed to loadCheckpoint must be built with the same
+        // model and the solver must use the same strategy
+        bool saveCheckpoint(const std::string& path, const CSProblem<T>& problem) const
         {
-            problem.setDomains(domains);
+            return _engine.save_checkpoint(path, problem);
         }
 
-
-        // Check if an assignment is correct
-        bool isValidAssignment(const CSProblem<T>& problem, Variable v, T value)
+        bool loadCheckpoint(const std::string& path, CSProblem<T>& problem)
         {
-            std::unordered_map<Variable, T> singleAssignment = {{v, value}};
-
-            for (Constraint<T> c: problem.getConstraints())
-            {
-                // Copy single assisgment to test constraint
-                Assignment<T> assignment = singleAssignment;
-
-                // If constraint doen't involve variable v, don't check it
-                if(!c.has_variable(v)) continue;
+            if (_strategy == CSPSrategy::ArcConsistency) return false;
+            _engine = CSPSearchEngine<T>(engine_options());
+            _search_started = _engine.load_checkpoint(path, problem);
+            return _search_started;
+        }
 
-                //Fill the assignment with missing variables
-                std::unordered_map<Variable, T> currentState = problem.getCurrentState();
-                for(auto cv: c.getConstraintVariables())
-                {
-                    // If the value is not assigned yet, consider as a valid assignment
-                    if(!currentState.contains(cv)) continue;
+        void _enableChrono(bool enabled=true) {_enable_chrono = enabled;}
 
-                    if(!assignment.getVariables().contains(cv)) assignment.assign(cv, currentState[cv]);
-                }
+        void setLimits(const CSPLimits& limits) {_limits = limits;}
+        // The token is not owned by the solver and must outlive the solve() calls
+        void setCancellationToken(const CancellationToken* token) {_token = token;}
 
-                // Check if the assignment is satisfied
-                if(!c.is_satisfied(assignment)) 
-                    return false;
-            }
+        CSPStopReason getStopReason() const {return _monitor.reason();}
+        std::uint64_t getVisitedNodes() const {return _monitor.nodes();}
 
-            return true;
-        }
+    private: 
+        CSPSrategy _strategy;
 
-        // Strategies
-        bool backtracking(CSProblem<T>& problem)
-        {
-            // 0. Select an unassigned variable; if empty a solution has been found
-            if ((int)problem.getUnassignedVariables().size() == 0)
-                return true;
+        bool _enable_chrono;
+        std::chrono::high_resolution_clock::time_point _start, _end;
 
-            Variable variable = problem.getUnassignedVariables()[0];
-            Domain<T> domain = problem.getDomain(variable);
+        CSPLimits _limits;
+        const CancellationToken* _token;
+        SearchMonitor _monitor;
 
-            //TODO: check var e dom
+        CSPSearchEngine<T> _engine;
+        bool _search_started;   // _engine holds a search that resume() can continue
+        SupportMask _mask;
 
-            // 1. Try each domain value until it's valid
-            for (const T& value : domain.get_values())
-            {
-                // 2. Check current problem assignment
-                if (isValidAssignment(problem, variable, value))
-                {
-                    // 3. Value is valid for variable, assign it and go deeper
-                    problem.assignValue(variable, value);
-                    if (backtracking(problem))
-                        return true;
-                    // 4. No solution found with that value, try another value
-                    problem.unassignValue(variable);
-                }
-            }
+        // Utility solver methods
 
-            return false; // No solution found
+        typename CSPSearchEngine<T>::Options engine_options() const
+        {
+            typename CSPSearchEngine<T>::Options options;
+            options.forward_checking = _strategy != CSPSrategy::Backtracking;
+            options.minimum_remaining_values = _strategy == CSPSrategy::BacktrackingEuristics;
+            return options;
         }
 
-        bool backtracking_forward_checking(CSProblem<T>& problem)        
+        CSPResult finish(CSProblem<T>& problem, bool problem_solved)
         {
-            // 0. Select an unassigned variable; if empty a solution has been found
-            if ((int)problem.getUnassignedVariables().size() == 0)
-                return true;
-
-            Variable variable = problem.getUnassignedVariables()[0];
-            Domain<T> domain = problem.getDomain(variable);
-
-            //TODO: check var e dom
-
-            // 1. Try each domain value until it's valid
-            for (const T& value : domain.get_values())
+            if(_enable_chrono) 
             {
-                // 2. Check current problem assignment
-                if (isValidAssignment(problem, variable, value))
-                {
-                    // 3. Value is valid for variable, assign it and go deeper
-                    problem.assignValue(variable, value);
-                    // Forward-Checking step:
-                    auto original_domains = forward_check(problem, variable, value);
-                    // 4. Remove value from incompatibles domains of problem variables
-                    if (backtracking_forward_checking(problem))
-                        return true;
-                    // 5. Revert forward check
-                    revert_forward_check(problem, original_domains);
-                    // 6. No solution found with that value, try another value
-                    problem.unassignValue(variable);
-                }
+                _end = std::chrono::high_resolution_clock::now();
+                int duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(_end - _start).count();
+                std::cout << "Execution time: " << duration_ms << " ms" << std::endl;
             }
+            problem.set_solved(problem_solved);
 
-            return false; // No solution found
+            if(problem_solved) return CSPResult::SAT;
+            return _monitor.stopped() ? CSPResult::UNKNOWN : CSPResult::UNSAT;
         }
 
-        bool backtracking_with_euristics(CSProblem<T>& problem){return false;};
+        // Strategies
+
+        // Backtracking, ForwardChecking and BacktrackingEuristics (forward checking with MRV ordering)
+        // run on CSPSearchEngine
 
         bool arc_consistency(CSPBinaryProblem<T>& problem){
 
@@ -232,6 +152,8 @@ namespace CSP
 
             while (!queue.empty()) 
             {
+                if (_monitor.should_stop(queue.size() * sizeof(Constraint<T>))) return false;
+
                 // 1. Take the first arc (X,Y) and check the of X respect of Y
                 Constraint<T> arc = queue.front();
                 queue.pop();
@@ -242,32 +164,43 @@ namespace CSP
                 Domain<T>& Dx = problem.getDomain(X);
                 Domain<T>& Dy = problem.getDomain(Y);
 
-                bool changed = false;
-
+                // 1.1 For each Di in D(X) check if C(Di, Dj) for some Dj in D(Y); if no remove Di from D(X)
+                std::vector<T> kept;
+                kept.reserve(Dx.get_values().size());
                 for(auto Di: Dx.get_values())
                 {
-                    // 1.1 For each Di in D(X) check if C(Di, Dj) for each Dj in D(Y)
                     bool consistent = false;
-                    for(auto Dj: Dy.get_values())
+                    bool batched = false;
+                    if constexpr (std::is_arithmetic_v<T>)
                     {
-                        Assignment<T> assignment;
-                        assignment.assign(X,Di);
-                        assignment.assign(Y,Dj);
-                        if(arc.is_satisfied(assignment))
+                        if(arc.getRelation())
                         {
-                            consistent = true;
-                            break;
+                            // Binary relational constraint: all the supports of Di in D(Y) at once
+                            batch_support(*arc.getRelation(), 1, Di, Dy.get_values(), _mask);
+                            for(auto word: _mask) consistent |= word != 0;
+                            batched = true;
                         }
                     }
-                    // If no remove Di in D(X)
-                    if(!consistent) 
+                    if(!batched)
                     {
-                        Dx.remove(Di);   
-                        changed = true;
-                    }             
-                    // Otherwise check next D(X) value
+                        for(auto Dj: Dy.get_values())
+                        {
+                            Assignment<T> assignment;
+                            assignment.assign(X,Di);
+                            assignment.assign(Y,Dj);
+                            if(arc.is_satisfied(assignment))
+                            {
+                                consistent = true;
+                                break;
+                            }
+                        }
+                    }
+                    if(consistent) kept.push_back(Di);
                 }
 
+                bool changed = kept.size() != Dx.get_values().size();
+                if(changed) Dx.set(std::move(kept));
+
                 // If Dx is empty, problem has no solution
                 if(Dx.get_values().empty()) return false;
                 
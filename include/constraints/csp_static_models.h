@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <constraints/csp_static_problem.h>
+
+namespace CSP
+{
+    // One NotEqual constraint for each pair of sudoku cells in the same row, column or square (810)
+    constexpr std::array<StaticConstraint, 810> sudoku_constraints()
+    {
+        std::array<StaticConstraint, 810> constraints{};
+        std::size_t n = 0;
+        for (std::uint32_t a = 0; a < 81; a++)
+            for (std::uint32_t b = a + 1; b < 81; b++)
+            {
+                std::uint32_t ra = a / 9, ca = a % 9, rb = b / 9, cb = b % 9;
+                if (ra == rb || ca == cb || (ra / 3 == rb / 3 && ca / 3 == cb / 3))
+                    constraints[n++] = {a, b, Relation::NotEqual, 0};
+            }
+        return constraints;
+    }
+
+    // For each pair of N-Queens rows: different columns and different diagonals
+    template <std::size_t N>
+    constexpr std::array<StaticConstraint, N * (N - 1)> queens_constraints()
+    {
+        std::array<StaticConstraint, N * (N - 1)> constraints{};
+        std::size_t n = 0;
+        for (std::uint32_t i = 0; i < N; i++)
+            for (std::uint32_t j = i + 1; j < N; j++)
+            {
+                constraints[n++] = {i, j, Relation::NotEqual, 0};
+                constraints[n++] = {i, j, Relation::DistanceNotEqual, (int)(j - i)};
+            }
+        return constraints;
+    }
+
+    // 9x9 sudoku: variable row*9+col (0-based), values 1..9
+    struct StaticSudoku
+    {
+        static constexpr std::size_t variables = 81;
+        static constexpr std::size_t domain_size = 9;
+        static constexpr int min_value = 1;
+        static constexpr std::array<StaticConstraint, 810> constraints = sudoku_constraints();
+    };
+
+    // N-Queens: variable i is the column (0..N-1) of the queen on row i
+    template <std::size_t N>
+    struct StaticQueens
+    {
+        static constexpr std::size_t variables = N;
+        static constexpr std::size_t domain_size = N;
+        static constexpr int min_value = 0;
+        static constexpr std::array<StaticConstraint, N * (N - 1)> constraints = queens_constraints<N>();
+    };
+
+};
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#include <constraints/utils/csp_relation.h>
+#include <constraints/utils/csp_static_domain.h>
+
+namespace CSP
+{
+    // Binary constraint of a fixed-size model: x relation y
+    struct StaticConstraint
+    {
+        std::uint32_t x = 0;
+        std::uint32_t y = 0;
+        Relation relation = Relation::NotEqual;
+        int k = 0;
+    };
+
+    // A fixed-size model is a type with:
+    //   static constexpr std::size_t variables;     number of variables (0..variables-1)
+    //   static constexpr std::size_t domain_size;   values min_value..min_value+domain_size-1
+    //   static constexpr int min_value;
+    //   static constexpr std::array<StaticConstraint, M> constraints;
+    template <typename Model>
+    concept StaticModel = requires
+    {
+        { Model::variables } -> std::convertible_to<std::size_t>;
+        { Model::domain_size } -> std::convertible_to<std::size_t>;
+        { Model::min_value } -> std::convertible_to<int>;
+        Model::constraints.size();
+    };
+
+    // Constraint seen from one of its variables
+    struct StaticArc
+    {
+        std::uint32_t neighbor = 0;
+        Relation relation = Relation::NotEqual;
+        int k = 0;
+        bool reversed = false; // the variable is the y of the constraint
+    };
+
+    // Compressed adjacency table of a model: arcs[offsets[v]..offsets[v+1]) are the arcs of v,
+    // owner[a] is the variable of arc a and twin[a] the same constraint seen from the neighbor
+    template <StaticModel Model>
+    struct StaticAdjacency
+    {
+        static constexpr std::size_t size = Model::constraints.size() * 2;
+
+        std::array<std::size_t, Model::variables + 1> offsets{};
+        std::array<StaticArc, size> arcs{};
+        std::array<std::uint32_t, size> owner{};
+        std::array<std::uint32_t, size> twin{};
+    };
+
+    template <StaticModel Model>
+    constexpr StaticAdjacency<Model> build_adjacency()
+    {
+        StaticAdjacency<Model> adjacency;
+
+        // 1. Count the arcs of each variable
+        for (const StaticConstraint& c: Model::constraints)
+        {
+            adjacency.offsets[c.x + 1]++;
+            adjacency.offsets[c.y + 1]++;
+        }
+        for (std::size_t v = 0; v < Model::variables; v++)
+            adjacency.offsets[v + 1] += adjacency.offsets[v];
+
+        // 2. Fill them
+        std::array<std::size_t, Model::variables> next{};
+        for (std::size_t v = 0; v < Model::variables; v++) next[v] = adjacency.offsets[v];
+        for (const StaticConstraint& c: Model::constraints)
+        {
+            std::size_t a = next[c.x]++;
+            std::size_t b = next[c.y]++;
+            adjacency.arcs[a] = {c.y, c.relation, c.k, false};
+            adjacency.arcs[b] = {c.x, c.relation, c.k, true};
+            adjacency.owner[a] = c.x;
+            adjacency.owner[b] = c.y;
+            adjacency.twin[a] = b;
+            adjacency.twin[b] = a;
+        }
+
+        return adjacency;
+    }
+
+    // Problem instance of a fixed-size model: domains and solution live in fixed-size arrays
+    template <StaticModel Model>
+    class CSPStaticProblem
+    {
+    public:
+        static constexpr std::size_t variables = Model::variables;
+        using Domain = StaticDomain<Model::domain_size>;
+
+        CSPStaticProblem():_solved(false)
+        {
+            _domains.fill(Domain::full());
+            _assigned.fill(false);
+            _solution.fill(Model::min_value);
+        };
+
+        // Fix the value of a variable before solving (e.g. sudoku clues)
+        void assignValue(std::size_t variable, int value)
+        {
+            assert(in_range(variable, value) && "variable or value outside of the model");
+            _domains[variable] = Domain::single(value - Model::min_value);
+            _assigned[variable] = true;
+        }
+
+        void removeValue(std::size_t variable, int value)
+        {
+            assert(in_range(variable, value) && "variable or value outside of the model");
+            _domains[variable].reset(value - Model::min_value);
+        }
+
+        const Domain& getDomain(std::size_t variable) const { return _domains[variable]; }
+        bool isAssigned(std::size_t variable) const { return _assigned[variable]; }
+
+        bool getSolution(std::array<int, Model::variables>* solution) const
+        {
+            *solution = _solution;
+            return _solved;
+        }
+
+        void setSolution(std::size_t variable, int value) { _solution[variable] = value; }
+        void set_solved(bool solved){_solved=solved;}
+
+    private:
+        static constexpr bool in_range(std::size_t variable, int value)
+        {
+            return variable < Model::variables && value >= Model::min_value
+                && (long long)value - Model::min_value < (long long)Model::domain_size;
+        }
+
+        std::array<Domain, Model::variables> _domains;
+        std::array<bool, Model::variables> _assigned;
+        std::array<int, Model::variables> _solution;
+
+        bool _solved;
+    };
+
+};
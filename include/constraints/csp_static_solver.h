@@ -0,0 +1,290 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <constraints/csp_static_problem.h>
+#include <constraints/utils/csp_limits.h>
+#include <constraints/utils/csp_strategy.h>
+
+namespace CSP
+{
+    // Solver specialized at compile time for a fixed-size model: domains are StaticDomain bitsets,
+    // the constraint graph is a constexpr adjacency table and the search works on fixed-size arrays,
+    // so solve() does not allocate.
+    //   Backtracking:          check each value against the assigned neighbors
+    //   ForwardChecking:       prune the neighbors' domains after each assignment
+    //   BacktrackingEuristics: forward checking with MRV variable ordering
+    //   ArcConsistency:        AC-3 on the initial domains, then forward checking
+    template <StaticModel Model>
+    class CSPStaticSolver
+    {
+    public:
+        static constexpr std::size_t N = Model::variables;
+        static constexpr StaticAdjacency<Model> adjacency = build_adjacency<Model>();
+
+        using Domain = StaticDomain<Model::domain_size>;
+        using Domains = std::array<Domain, N>;
+
+        CSPStaticSolver(CSPSrategy s):_strategy(s), _token(nullptr){};
+        ~CSPStaticSolver(){};
+
+        CSPResult solve(CSPStaticProblem<Model>& problem)
+        {
+            _monitor.start(_limits, _token);
+
+            const bool forward_checking = _strategy != CSPSrategy::Backtracking;
+
+            // 0. Initial domains, filtered by the values fixed in the problem
+            for (std::size_t v = 0; v < N; v++)
+            {
+                _levels[0][v] = problem.getDomain(v);
+                _assigned[v] = problem.isAssigned(v);
+                if (_assigned[v]) _values[v] = _levels[0][v].first();
+            }
+
+            bool consistent = true;
+            for (std::size_t v = 0; v < N && consistent; v++)
+            {
+                if (!_assigned[v]) continue;
+                consistent = forward_checking ? forward_check(_levels[0], v, _values[v]) : is_consistent(v, _values[v]);
+            }
+            if (consistent && _strategy == CSPSrategy::ArcConsistency)
+                consistent = arc_consistency(_levels[0]);
+
+            CSPResult result = consistent ? search(problem, forward_checking) : CSPResult::UNSAT;
+            problem.set_solved(result == CSPResult::SAT);
+            return result;
+        }
+
+        // max_memory_bytes never stops this solver: the search only uses its fixed-size arrays
+        void setLimits(const CSPLimits& limits) {_limits = limits;}
+        // The token is not owned by the solver and must outlive the solve() calls
+        void setCancellationToken(const CancellationToken* token) {_token = token;}
+
+        CSPStopReason getStopReason() const {return _monitor.reason();}
+        std::uint64_t getVisitedNodes() const {return _monitor.nodes();}
+
+    private:
+        static constexpr std::size_t npos = N;
+
+        // One level of the search: variable and values not tried yet
+        struct Frame
+        {
+            std::size_t variable;
+            Domain remaining;
+        };
+
+        CSPSrategy _strategy;
+
+        CSPLimits _limits;
+        const CancellationToken* _token;
+        SearchMonitor _monitor;
+
+        std::array<Domains, N + 1> _levels;     // domains before the assignment of each level
+        std::array<Frame, N> _frames;
+        std::array<bool, N> _assigned;
+        std::array<std::size_t, N> _values;      // value index of the assigned variables
+
+        CSPResult search(CSPStaticProblem<Model>& problem, bool forward_checking)
+        {
+            std::size_t root = select_variable(_levels[0], 0);
+            if (root == npos)
+                return write_solution(problem);
+
+            std::size_t depth = 0;
+            _frames[0] = {root, _levels[0][root]};
+            if (_monitor.should_stop())
+                return CSPResult::UNKNOWN;
+
+            while (true)
+            {
+                Frame& frame = _frames[depth];
+
+                // 1. No more values: go back to the previous level
+                if (frame.remaining.empty())
+                {
+                    _assigned[frame.variable] = false;
+                    if (depth == 0) return CSPResult::UNSAT;
+                    depth--;
+                    continue;
+                }
+
+                // 2. Try the next value
+                std::size_t value = frame.remaining.first();
+                frame.remaining.reset(value);
+
+                _assigned[frame.variable] = true;
+                _values[frame.variable] = value;
+
+                // Without forward checking every level shares the initial domains
+                Domains& domains = forward_checking ? _levels[depth + 1] : _levels[0];
+                if (forward_checking)
+                {
+                    domains = _levels[depth];
+                    domains[frame.variable] = Domain::single(value);
+                    if (!forward_check(domains, frame.variable, value)) continue;
+                }
+                else if (!is_consistent(frame.variable, value)) continue;
+
+                // 3. Go deeper, or stop if every variable has a value
+                std::size_t next = select_variable(domains, frame.variable + 1);
+                if (next == npos)
+                    return write_solution(problem);
+
+                _frames[++depth] = {next, domains[next]};
+                if (_monitor.should_stop())
+                    return CSPResult::UNKNOWN;
+            }
+        }
+
+        CSPResult write_solution(CSPStaticProblem<Model>& problem)
+        {
+            for (std::size_t v = 0; v < N; v++)
+                problem.setSolution(v, Model::min_value + (int)_values[v]);
+            return CSPResult::SAT;
+        }
+
+        std::size_t select_variable(const Domains& domains, std::size_t from) const
+        {
+            if (_strategy != CSPSrategy::BacktrackingEuristics)
+            {
+                // Every variable before the current one is assigned: keep scanning forward
+                for (std::size_t v = from; v < N; v++)
+                    if (!_assigned[v]) return v;
+                return npos;
+            }
+
+            std::size_t best = npos, best_count = Model::domain_size + 1;
+            for (std::size_t v = 0; v < N; v++)
+            {
+                if (_assigned[v]) continue;
+                std::size_t count = domains[v].count();
+                if (count < best_count)
+                {
+                    best = v;
+                    best_count = count;
+                }
+            }
+            return best;
+        }
+
+        // Values of the neighbor of arc compatible with value of the arc variable
+        static constexpr Domain support(const StaticArc& arc, std::size_t value)
+        {
+            switch (arc.relation)
+            {
+                case Relation::Equal:
+                    return Domain::single(value);
+                case Relation::NotEqual:
+                    return ~Domain::single(value);
+                case Relation::Less:
+                    return arc.reversed ? Domain::below(value) : Domain::above(value);
+                case Relation::DistanceNotEqual:
+                {
+                    // |x - y| != k always holds for a negative k
+                    Domain d = Domain::full();
+                    if (arc.k < 0) return d;
+                    const long long below = (long long)value - arc.k, above = (long long)value + arc.k;
+                    if (below >= 0) d.reset((std::size_t)below);
+                    if (above < (long long)Model::domain_size) d.reset((std::size_t)above);
+                    return d;
+                }
+            }
+            return Domain::full();
+        }
+
+        bool is_consistent(std::size_t v, std::size_t value) const
+        {
+            for (std::size_t a = adjacency.offsets[v]; a < adjacency.offsets[v + 1]; a++)
+            {
+                const StaticArc& arc = adjacency.arcs[a];
+                if (!_assigned[arc.neighbor] || arc.neighbor == v) continue;
+
+                int mine = (int)value, other = (int)_values[arc.neighbor];
+                bool holds = arc.reversed ? relation_holds(arc.relation, other, mine, arc.k)
+                                          : relation_holds(arc.relation, mine, other, arc.k);
+                if (!holds) return false;
+            }
+            return true;
+        }
+
+        bool forward_check(Domains& domains, std::size_t v, std::size_t value) const
+        {
+            for (std::size_t a = adjacency.offsets[v]; a < adjacency.offsets[v + 1]; a++)
+            {
+                const StaticArc& arc = adjacency.arcs[a];
+                Domain& neighbor = domains[arc.neighbor];
+
+                if (_assigned[arc.neighbor])
+                {
+                    if (!support(arc, value).test(_values[arc.neighbor])) return false;
+                    continue;
+                }
+                neighbor &= support(arc, value);
+                if (neighbor.empty()) return false;
+            }
+            return true;
+        }
+
+        // AC-3 on the arcs of the adjacency table (queue and flags are fixed-size arrays)
+        bool arc_consistency(Domains& domains) const
+        {
+            constexpr std::size_t A = StaticAdjacency<Model>::size;
+            if constexpr (A == 0) return true;
+            else
+            {
+                std::array<std::uint32_t, A> queue;
+                std::array<bool, A> queued;
+                std::size_t head = 0, count = A;
+                for (std::size_t a = 0; a < A; a++)
+                {
+                    queue[a] = (std::uint32_t)a;
+                    queued[a] = true;
+                }
+
+                while (count > 0)
+                {
+                    std::uint32_t a = queue[head];
+                    head = (head + 1) % A;
+                    count--;
+                    queued[a] = false;
+
+                    // 1. Remove the values of the arc variable without support in the neighbor
+                    const StaticArc& arc = adjacency.arcs[a];
+                    std::size_t v = adjacency.owner[a];
+                    Domain& dv = domains[v];
+                    const Domain& du = domains[arc.neighbor];
+
+                    bool changed = false;
+                    Domain values = dv;
+                    for (std::size_t x = values.first(); x < Model::domain_size; x = values.first())
+                    {
+                        values.reset(x);
+                        if (!support(arc, x).intersects(du))
+                        {
+                            dv.reset(x);
+                            changed = true;
+                        }
+                    }
+
+                    if (dv.empty()) return false;
+                    if (!changed) continue;
+
+                    // 2. Check again the arcs pointing to the reduced variable
+                    for (std::size_t b = adjacency.offsets[v]; b < adjacency.offsets[v + 1]; b++)
+                    {
+                        std::uint32_t back = adjacency.twin[b];
+                        if (back == adjacency.twin[a] || queued[back]) continue;
+                        queue[(head + count) % A] = back;
+                        queued[back] = true;
+                        count++;
+                    }
+                }
+                return true;
+            }
+        }
+    };
+
+};
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <constraints/utils/csp_relation.h>
+#include <constraints/utils/csp_constraint.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CSP_BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+namespace CSP
+{
+    // Bit i is set if the i-th candidate value is supported
+    using SupportMask = std::vector<std::uint64_t>;
+
+    enum class SimdLevel
+    {
+        Scalar,
+        SSE,    // SSE2, 4 values per step
+        AVX2    // 8 values per step
+    };
+
+    // Comparison of each candidate value v against a fixed value f
+    enum class BatchOp
+    {
+        Equal,              // v == f
+        NotEqual,           // v != f
+        Greater,            // v > f
+        Less,               // v < f
+        DistanceNotEqual    // |v - f| != k (k >= 0, a negative k supports every value)
+    };
+
+    // Operation checking the variable at position (0 = x, 1 = y) of "x relation y" when the other one is fixed
+    inline BatchOp batch_op(Relation relation, std::size_t position)
+    {
+        switch (relation)
+        {
+            case Relation::Equal: return BatchOp::Equal;
+            case Relation::NotEqual: return BatchOp::NotEqual;
+            case Relation::Less: return position == 0 ? BatchOp::Less : BatchOp::Greater;
+            case Relation::DistanceNotEqual: return BatchOp::DistanceNotEqual;
+        }
+        return BatchOp::Equal;
+    }
+
+    // Kernels: mask must hold (n + 63) / 64 words, set to zero by the caller
+
+    inline void batch_compare_scalar(BatchOp op, int fixed, int k, const int* values, std::size_t n, std::uint64_t* mask)
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            int v = values[i];
+            bool supported = false;
+            switch (op)
+            {
+                case BatchOp::Equal: supported = v == fixed; break;
+                case BatchOp::NotEqual: supported = v != fixed; break;
+                case BatchOp::Greater: supported = v > fixed; break;
+                case BatchOp::Less: supported = v < fixed; break;
+                case BatchOp::DistanceNotEqual:
+                {
+                    // Same wrap-around arithmetic of the vector kernels
+                    std::uint32_t d = (std::uint32_t)v - (std::uint32_t)fixed;
+                    supported = d != (std::uint32_t)k && d != (std::uint32_t)-k;
+                    break;
+                }
+            }
+            mask[i / 64] |= (std::uint64_t)supported << (i % 64);
+        }
+    }
+
+#if defined(CSP_BATCH_X86)
+    // SSE2 is part of the x86-64 baseline, no target attribute needed
+    inline void batch_compare_sse(BatchOp op, int fixed, int k, const int* values, std::size_t n, std::uint64_t* mask)
+    {
+        const __m128i f = _mm_set1_epi32(fixed);
+        const __m128i pk = _mm_set1_epi32(k);
+        const __m128i nk = _mm_set1_epi32(-k);
+
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(values + i));
+            __m128i r;
+            int bits;
+            switch (op)
+            {
+                case BatchOp::Equal: r = _mm_cmpeq_epi32(v, f); break;
+                case BatchOp::NotEqual: r = _mm_cmpeq_epi32(v, f); break;
+                case BatchOp::Greater: r = _mm_cmpgt_epi32(v, f); break;
+                case BatchOp::Less: r = _mm_cmplt_epi32(v, f); break;
+                case BatchOp::DistanceNotEqual:
+                {
+                    __m128i d = _mm_sub_epi32(v, f);
+                    r = _mm_or_si128(_mm_cmpeq_epi32(d, pk), _mm_cmpeq_epi32(d, nk));
+                    break;
+                }
+                default: r = _mm_setzero_si128(); break;
+            }
+            bits = _mm_movemask_ps(_mm_castsi128_ps(r));
+            if (op == BatchOp::NotEqual || op == BatchOp::DistanceNotEqual) bits ^= 0xF;
+            mask[i / 64] |= (std::uint64_t)bits << (i % 64);
+        }
+        if (i < n)
+        {
+            std::uint64_t tail[1] = {0};
+            batch_compare_scalar(op, fixed, k, values + i, n - i, tail);
+            mask[i / 64] |= tail[0] << (i % 64);
+        }
+    }
+
+    __attribute__((target("avx2")))
+    inline void batch_compare_avx2(BatchOp op, int fixed, int k, const int* values, std::size_t n, std::uint64_t* mask)
+    {
+        const __m256i f = _mm256_set1_epi32(fixed);
+        const __m256i pk = _mm256_set1_epi32(k);
+        const __m256i nk = _mm256_set1_epi32(-k);
+
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(values + i));
+            __m256i r;
+            int bits;
+            switch (op)
+            {
+                case BatchOp::Equal: r = _mm256_cmpeq_epi32(v, f); break;
+                case BatchOp::NotEqual: r = _mm256_cmpeq_epi32(v, f); break;
+                case BatchOp::Greater: r = _mm256_cmpgt_epi32(v, f); break;
+                case BatchOp::Less: r = _mm256_cmpgt_epi32(f, v); break;
+                case BatchOp::DistanceNotEqual:
+                {
+                    __m256i d = _mm256_sub_epi32(v, f);
+                    r = _mm256_or_si256(_mm256_cmpeq_epi32(d, pk), _mm256_cmpeq_epi32(d, nk));
+                    break;
+                }
+                default: r = _mm256_setzero_si256(); break;
+            }
+            bits = _mm256_movemask_ps(_mm256_castsi256_ps(r));
+            if (op == BatchOp::NotEqual || op == BatchOp::DistanceNotEqual) bits ^= 0xFF;
+            mask[i / 64] |= (std::uint64_t)bits << (i % 64);
+        }
+        if (i < n)
+        {
+            std::uint64_t tail[1] = {0};
+            batch_compare_scalar(op, fixed, k, values + i, n - i, tail);
+            mask[i / 64] |= tail[0] << (i % 64);
+        }
+    }
+#endif
+
+    inline bool simd_level_supported(SimdLevel level)
+    {
+        switch (level)
+        {
+            case SimdLevel::Scalar: return true;
+#if defined(CSP_BATCH_X86)
+            case SimdLevel::SSE: return __builtin_cpu_supports("sse2");
+            case SimdLevel::AVX2: return __builtin_cpu_supports("avx2");
+#endif
+            default: return false;
+        }
+    }
+
+    // Best kernel available on this CPU, detected once
+    inline SimdLevel best_simd_level()
+    {
+        static const SimdLevel level = simd_level_supported(SimdLevel::AVX2) ? SimdLevel::AVX2
+                                     : simd_level_supported(SimdLevel::SSE) ? SimdLevel::SSE
+                                     : SimdLevel::Scalar;
+        return level;
+    }
+
+    inline void batch_compare(BatchOp op, int fixed, int k, const int* values, std::size_t n, std::uint64_t* mask,
+                              SimdLevel level = best_simd_level())
+    {
+        if (op == BatchOp::DistanceNotEqual && k < 0)
+        {
+            for (std::size_t i = 0; i < n; i++) mask[i / 64] |= std::uint64_t(1) << (i % 64);
+            return;
+        }
+
+        switch (level)
+        {
+#if defined(CSP_BATCH_X86)
+            case SimdLevel::AVX2: batch_compare_avx2(op, fixed, k, values, n, mask); return;
+            case SimdLevel::SSE: batch_compare_sse(op, fixed, k, values, n, mask); return;
+#endif
+            default: batch_compare_scalar(op, fixed, k, values, n, mask); return;
+        }
+    }
+
+    // Supports of the variable at position (0 = x, 1 = y) of "x relation y" when the other variable is fixed
+    template <typename T>
+    void batch_support(const BinaryRelation<T>& relation, std::size_t position, const T& fixed,
+                       const std::vector<T>& candidates, SupportMask& mask)
+    {
+        mask.assign((candidates.size() + 63) / 64, 0);
+
+        if constexpr (std::is_same_v<T, int>)
+        {
+            batch_compare(batch_op(relation.relation, position), fixed, relation.k, candidates.data(), candidates.size(), mask.data());
+        }
+        else
+        {
+            for (std::size_t i = 0; i < candidates.size(); i++)
+            {
+                bool supported = position == 0 ? relation_holds(relation.relation, candidates[i], fixed, relation.k)
+                                                : relation_holds(relation.relation, fixed, candidates[i], relation.k);
+                mask[i / 64] |= (std::uint64_t)supported << (i % 64);
+            }
+        }
+    }
+
+    // Supports of variable in any constraint, given the values already fixed in assignment.
+    // Binary relational constraints with the other variable fixed are checked in one batch,
+    // any other constraint falls back to one is_satisfied() per candidate.
+    template <typename T>
+    void batch_support(const Constraint<T>& constraint, const Assignment<T>& assignment, const Variable& variable,
+                       const std::vector<T>& candidates, SupportMask& mask)
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            const std::vector<Variable>& variables = constraint.getConstraintVariables();
+            if (constraint.getRelation() && variables.size() == 2 && (variables[0] == variable) != (variables[1] == variable))
+            {
+                std::size_t position = variables[0] == variable ? 0 : 1;
+                auto fixed = assignment.get_value(variables[1 - position]);
+                if (fixed)
+                {
+                    batch_support(*constraint.getRelation(), position, *fixed, candidates, mask);
+                    return;
+                }
+            }
+        }
+
+        mask.assign((candidates.size() + 63) / 64, 0);
+        Assignment<T> trial = assignment;
+        for (std::size_t i = 0; i < candidates.size(); i++)
+        {
+            trial.assign(variable, candidates[i]);
+            mask[i / 64] |= (std::uint64_t)constraint.is_satisfied(trial) << (i % 64);
+        }
+    }
+
+    inline bool is_supported(const SupportMask& mask, std::size_t i) { return (mask[i / 64] >> (i % 64)) & 1; }
+
+};
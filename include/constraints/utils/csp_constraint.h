@@ -4,8 +4,10 @@
 #include <functional>
 #include <unordered_map>
 #include <optional>
+#include <type_traits>
 
 #include <constraints/utils/csp_variable.h>
+#include <constraints/utils/csp_relation.h>
 
 namespace CSP
 {
@@ -43,18 +45,37 @@ namespace CSP
     private:
         std::vector<Variable> _variables;
         std::function<bool(std::vector<T>)> _rule;
+        std::optional<BinaryRelation<T>> _relation;
     public:    
         Constraint(std::vector<Variable> variables, std::function<bool(std::vector<T>)> rule):_variables(variables), _rule(rule){};
         ~Constraint() = default;
 
-        std::vector<Variable> getConstraintVariables() const { return _variables;}
+        // Binary constraint x relation y: besides the rule, the relation is known to the solvers,
+        // which can check a whole domain at once (see csp_batch_check.h). T must be arithmetic.
+        static Constraint relational(Variable x, Variable y, Relation relation, T k = T()) requires std::is_arithmetic_v<T>
+        {
+            Constraint c({x, y}, [relation, k](std::vector<T> values) -> bool
+            {
+                return values.size() < 2 || relation_holds(relation, values[0], values[1], k);
+            });
+            c._relation = BinaryRelation<T>{relation, k};
+            return c;
+        }
 
-        Constraint duplicate(std::vector<Variable> variables) {return Constraint<T>(variables, _rule);} 
+        const std::vector<Variable>& getConstraintVariables() const { return _variables;}
+        const std::optional<BinaryRelation<T>>& getRelation() const { return _relation;}
+
+        Constraint duplicate(std::vector<Variable> variables) 
+        {
+            Constraint<T> c(variables, _rule);
+            c._relation = _relation;
+            return c;
+        } 
         
-        bool has_variable(const Variable& v) {return std::find(_variables.begin(), _variables.end(), v) != _variables.end();}
+        bool has_variable(const Variable& v) const {return std::find(_variables.begin(), _variables.end(), v) != _variables.end();}
 
         // Verify if a constraint is satisfied with a certain assignment of values
-        bool is_satisfied(const Assignment<T>& assignment) 
+        bool is_satisfied(const Assignment<T>& assignment) const
         {
             std::vector<T> assignment_values;
 
@@ -24,7 +24,7 @@ namespace CSP
 
             const std::vector<T>& get_values() const {return _values;}
 
-            void set(std::vector<T> range){_values=range;}
+            void set(std::vector<T> range){_values=std::move(range);}
             // int get_variable_id() const {return variable_id;}
         private:
             // TODO: use std::set to improve erase operation ((O(log n) fpr set o O(1) for unordered_set))
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace CSP
+{
+    // Outcome of a solve: UNKNOWN means the search was cut off before it could prove anything
+    enum class CSPResult
+    {
+        SAT,
+        UNSAT,
+        UNKNOWN
+    };
+
+    // Why a search has been stopped before completion
+    enum class CSPStopReason
+    {
+        None,
+        Cancelled,
+        TimeLimit,
+        NodeLimit,
+        MemoryLimit
+    };
+
+    // Resource budgets for a single solve; a zero value means "no limit".
+    // max_memory_bytes bounds the memory held by the search itself (stack, trail and saved
+    // domains), not the memory of the process, so solves running on other threads do not count.
+    struct CSPLimits
+    {
+        std::chrono::milliseconds max_time{0};
+        std::uint64_t max_nodes = 0;
+        std::size_t max_memory_bytes = 0;
+    };
+
+    // Shared flag used to ask a running search to stop (e.g. from another thread)
+    class CancellationToken
+    {
+    public:
+        CancellationToken():_cancelled(false){};
+
+        void cancel() { _cancelled.store(true, std::memory_order_relaxed); }
+        void reset() { _cancelled.store(false, std::memory_order_relaxed); }
+
+        bool is_cancelled() const { return _cancelled.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<bool> _cancelled;
+    };
+
+    // Keeps track of the budget of a search. should_stop() is meant to be called once per node
+    // with the memory currently held by the search: the node counter and the cancellation flag
+    // are checked every call, the clock and the memory only every few thousand nodes to keep
+    // the polling cost negligible.
+    class SearchMonitor
+    {
+    public:
+        static constexpr std::uint64_t clock_poll_interval = 1024;  // must be a power of 2
+        static constexpr std::uint64_t memory_poll_interval = 16384; // must be a power of 2
+
+        SearchMonitor() = default;
+
+        void start(const CSPLimits& limits, const CancellationToken* token)
+        {
+            _limits = limits;
+            _token = token;
+            _nodes = 0;
+            _reason = CSPStopReason::None;
+            _start = std::chrono::steady_clock::now();
+            _deadline = _start + _limits.max_time;
+            _max_nodes = _limits.max_nodes;
+        }
+
+        // Re-arm the budgets to continue a suspended search: the node counter is kept and
+        // max_nodes/max_time apply to the resumed run only
+        void resume(const CSPLimits& limits, const CancellationToken* token)
+        {
+            _limits = limits;
+            _token = token;
+            _reason = CSPStopReason::None;
+            _deadline = std::chrono::steady_clock::now() + _limits.max_time;
+            _max_nodes = _limits.max_nodes ? _nodes + _limits.max_nodes : 0;
+        }
+
+        bool should_stop(std::size_t memory_bytes = 0)
+        {
+            ++_nodes;
+            if (_reason != CSPStopReason::None) return true;
+
+            if (_token && _token->is_cancelled())
+                _reason = CSPStopReason::Cancelled;
+            else if (_max_nodes && _nodes > _max_nodes)
+                _reason = CSPStopReason::NodeLimit;
+            else if ((_nodes & (clock_poll_interval - 1)) == 0)
+                poll_resources(memory_bytes);
+
+            return _reason != CSPStopReason::None;
+        }
+
+        bool stopped() const { return _reason != CSPStopReason::None; }
+        CSPStopReason reason() const { return _reason; }
+        std::uint64_t nodes() const { return _nodes; }
+
+        std::chrono::milliseconds elapsed() const
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _start);
+        }
+
+    private:
+        void poll_resources(std::size_t memory_bytes)
+        {
+            if (_limits.max_time.count() > 0 && std::chrono::steady_clock::now() >= _deadline)
+                _reason = CSPStopReason::TimeLimit;
+            else if (_limits.max_memory_bytes && (_nodes & (memory_poll_interval - 1)) == 0
+                        && memory_bytes > _limits.max_memory_bytes)
+                _reason = CSPStopReason::MemoryLimit;
+        }
+
+        CSPLimits _limits;
+        const CancellationToken* _token = nullptr;
+
+        std::uint64_t _nodes = 0;
+        std::uint64_t _max_nodes = 0;
+        CSPStopReason _reason = CSPStopReason::None;
+
+        std::chrono::steady_clock::time_point _start, _deadline;
+    };
+
+};
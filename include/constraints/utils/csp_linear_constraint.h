@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#include <constraints/utils/csp_variable.h>
+#include <constraints/utils/csp_constraint.h>
+
+namespace CSP
+{
+    enum class LinearRelation
+    {
+        LessEqual,      // sum <= constant
+        Equal,          // sum == constant
+        GreaterEqual    // sum >= constant
+    };
+
+    // Linear constraint sum(coefficient_i * variable_i) relation constant over an integral type T
+    // (sums are exact, so the search and is_satisfied() always agree).
+    // Unlike Constraint<T> it is not a black box: the search engine propagates its bounds on
+    // partial assignments (e.g. x + y <= z is {x, y, z}, {1, 1, -1}, LessEqual, 0).
+    // There must be one coefficient per variable; a repeated variable adds up its coefficients.
+    template<typename T>
+    class LinearConstraint
+    {
+    private:
+        std::vector<Variable> _variables;
+        std::vector<T> _coefficients;
+        LinearRelation _relation;
+        T _constant;
+    public:
+        LinearConstraint(std::vector<Variable> variables, std::vector<T> coefficients, LinearRelation relation, T constant)
+            requires std::is_integral_v<T>
+            :_variables(std::move(variables)), _coefficients(std::move(coefficients)), _relation(relation), _constant(constant)
+        {
+            assert(_variables.size() == _coefficients.size() && "one coefficient per variable");
+        };
+        ~LinearConstraint() = default;
+
+        // sum(variables) relation constant
+        static LinearConstraint sum(std::vector<Variable> variables, LinearRelation relation, T constant) requires std::is_integral_v<T>
+        {
+            std::vector<T> coefficients(variables.size(), T(1));
+            return LinearConstraint(std::move(variables), std::move(coefficients), relation, constant);
+        }
+
+        const std::vector<Variable>& getConstraintVariables() const { return _variables;}
+        const std::vector<T>& getCoefficients() const { return _coefficients;}
+        LinearRelation getRelation() const { return _relation;}
+        T getConstant() const { return _constant;}
+
+        bool has_variable(const Variable& v) const {return std::find(_variables.begin(), _variables.end(), v) != _variables.end();}
+
+        // Verify the constraint on a complete assignment of its variables (true if some is missing)
+        bool is_satisfied(const Assignment<T>& assignment) const
+        {
+            T total = T(0);
+            for (std::size_t i = 0; i < _variables.size(); i++)
+            {
+                auto value = assignment.get_value(_variables[i]);
+                if (!value) return true;
+                total += _coefficients[i] * *value;
+            }
+
+            switch (_relation)
+            {
+                case LinearRelation::LessEqual: return total <= _constant;
+                case LinearRelation::Equal: return total == _constant;
+                case LinearRelation::GreaterEqual: return total >= _constant;
+            }
+            return false;
+        }
+    };
+
+};
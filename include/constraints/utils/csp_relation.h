@@ -0,0 +1,35 @@
+#pragma once
+
+namespace CSP
+{
+    // Binary relations between two variables x and y (k is the parameter of the relation, if any)
+    enum class Relation
+    {
+        Equal,              // x == y
+        NotEqual,           // x != y
+        Less,               // x < y
+        DistanceNotEqual    // |x - y| != k
+    };
+
+    template <typename T>
+    constexpr bool relation_holds(Relation relation, const T& x, const T& y, const T& k)
+    {
+        switch (relation)
+        {
+            case Relation::Equal: return x == y;
+            case Relation::NotEqual: return x != y;
+            case Relation::Less: return x < y;
+            case Relation::DistanceNotEqual: return (x < y ? y - x : x - y) != k;
+        }
+        return false;
+    }
+
+    // Relation attached to a binary Constraint (first variable is x, second is y)
+    template <typename T>
+    struct BinaryRelation
+    {
+        Relation relation;
+        T k;
+    };
+
+};
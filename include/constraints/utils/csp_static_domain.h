@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace CSP
+{
+    // Fixed-size domain of the values 0..D-1 stored as a bitset. Every loop runs over a
+    // compile-time number of words, so the operations are fully unrolled for small D.
+    template <std::size_t D>
+    class StaticDomain
+    {
+        public:
+            static constexpr std::size_t size = D;
+            static constexpr std::size_t words = (D + 63) / 64;
+
+            constexpr StaticDomain():_bits{}{};
+
+            // Domain with every value
+            static constexpr StaticDomain full()
+            {
+                StaticDomain d;
+                for (std::size_t w = 0; w < words; w++) d._bits[w] = ~std::uint64_t(0);
+                d.trim();
+                return d;
+            }
+
+            static constexpr StaticDomain single(std::size_t value)
+            {
+                StaticDomain d;
+                d.set(value);
+                return d;
+            }
+
+            // Values strictly lower than value
+            static constexpr StaticDomain below(std::size_t value)
+            {
+                StaticDomain d;
+                for (std::size_t w = 0; w < words; w++)
+                {
+                    std::size_t first = w * 64;
+                    if (value >= first + 64) d._bits[w] = ~std::uint64_t(0);
+                    else if (value > first) d._bits[w] = (std::uint64_t(1) << (value - first)) - 1;
+                }
+                d.trim();
+                return d;
+            }
+
+            // Values strictly greater than value
+            static constexpr StaticDomain above(std::size_t value)
+            {
+                StaticDomain d = ~below(value + 1);
+                return d;
+            }
+
+            constexpr bool test(std::size_t value) const { return (_bits[value / 64] >> (value % 64)) & 1; }
+            constexpr void set(std::size_t value) { _bits[value / 64] |= std::uint64_t(1) << (value % 64); }
+            constexpr void reset(std::size_t value) { _bits[value / 64] &= ~(std::uint64_t(1) << (value % 64)); }
+
+            constexpr std::size_t count() const
+            {
+                std::size_t n = 0;
+                for (std::size_t w = 0; w < words; w++) n += std::popcount(_bits[w]);
+                return n;
+            }
+
+            constexpr bool empty() const
+            {
+                std::uint64_t any = 0;
+                for (std::size_t w = 0; w < words; w++) any |= _bits[w];
+                return any == 0;
+            }
+
+            // Lowest value of the domain (D if empty)
+            constexpr std::size_t first() const
+            {
+                for (std::size_t w = 0; w < words; w++)
+                    if (_bits[w]) return w * 64 + std::countr_zero(_bits[w]);
+                return D;
+            }
+
+            constexpr bool intersects(const StaticDomain& other) const
+            {
+                std::uint64_t any = 0;
+                for (std::size_t w = 0; w < words; w++) any |= _bits[w] & other._bits[w];
+                return any != 0;
+            }
+
+            constexpr StaticDomain& operator&=(const StaticDomain& other)
+            {
+                for (std::size_t w = 0; w < words; w++) _bits[w] &= other._bits[w];
+                return *this;
+            }
+
+            constexpr StaticDomain operator&(const StaticDomain& other) const
+            {
+                StaticDomain d = *this;
+                d &= other;
+                return d;
+            }
+
+            constexpr StaticDomain operator~() const
+            {
+                StaticDomain d;
+                for (std::size_t w = 0; w < words; w++) d._bits[w] = ~_bits[w];
+                d.trim();
+                return d;
+            }
+
+            constexpr bool operator==(const StaticDomain& other) const = default;
+
+        private:
+            std::array<std::uint64_t, words> _bits;
+
+            // Clear the bits after the last value
+            constexpr void trim()
+            {
+                if constexpr (D % 64 != 0)
+                    _bits[words - 1] &= (std::uint64_t(1) << (D % 64)) - 1;
+            }
+    };
+
+};
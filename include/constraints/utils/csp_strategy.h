@@ -0,0 +1,17 @@
+#pragma once
+
+namespace CSP
+{
+    // Solving strategies shared by CSPSolver and CSPStaticSolver
+    enum class CSPSrategy
+    {
+        Backtracking,
+        BacktrackingEuristics,
+        ForwardChecking,
+        ArcConsistency //(AC-3)
+        // Local Search con Propagazione di Vincoli (Min-Conflicts)
+        // Algoritmo di Ricerca con Backjumping
+        // Tecniche di Propagazione di Vincoli Avanzate (e.g., Constraint Propagation)
+    };
+
+};
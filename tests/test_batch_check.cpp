@@ -0,0 +1,155 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <string>
+
+#include "../include/constraints/csp_solver.h"
+#include "../include/constraints/csp_binary_problem.h"
+#include "../include/constraints/utils/csp_batch_check.h"
+#include "test_utils.h"
+
+using namespace CSP;
+
+int main() {
+    std::cout << "Test Batch Constraint Checks.." << std::endl;
+
+    bool test_ok = true;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> value(-20, 20);
+
+    const Relation relations[] = {Relation::Equal, Relation::NotEqual, Relation::Less, Relation::DistanceNotEqual};
+
+    // TEST 1: Every kernel agrees with relation_holds, for every length (vector body and scalar tail)
+    for (SimdLevel level: {SimdLevel::Scalar, SimdLevel::SSE, SimdLevel::AVX2})
+    {
+        if (!simd_level_supported(level))
+        {
+            std::cout << "SIMD level " << (int)level << " not supported, skipped" << std::endl;
+            continue;
+        }
+
+        bool level_ok = true;
+        for (std::size_t n = 0; n <= 150; n++)
+        {
+            std::vector<int> candidates(n);
+            for (int& c: candidates) c = value(rng);
+            int fixed = value(rng);
+            int k = value(rng) % 5;
+
+            for (Relation relation: relations)
+                for (std::size_t position: {0, 1})
+                {
+                    std::vector<std::uint64_t> mask((n + 63) / 64, 0);
+                    batch_compare(batch_op(relation, position), fixed, k, candidates.data(), n, mask.data(), level);
+                    for (std::size_t i = 0; i < n; i++)
+                    {
+                        bool expected = position == 0 ? relation_holds(relation, candidates[i], fixed, k)
+                                                      : relation_holds(relation, fixed, candidates[i], k);
+                        level_ok &= is_supported(mask, i) == expected;
+                    }
+                }
+        }
+        test_ok &= check(level_ok, "Kernels at SIMD level " + std::to_string((int)level));
+    }
+
+    // TEST 2: batch_support on a constraint matches one is_satisfied() per candidate
+    {
+        std::vector<int> candidates;
+        for (int v = -10; v <= 10; v++) candidates.push_back(v);
+
+        Constraint<int> lambda({0, 1}, [](std::vector<int> v) { return v.size() < 2 || v[0] * v[1] > 3; });
+        Constraint<int> relational = Constraint<int>::relational(0, 1, Relation::DistanceNotEqual, 3);
+
+        bool support_ok = true;
+        for (const Constraint<int>& c: {lambda, relational})
+            for (int fixed: {-4, 0, 7})
+                for (int position: {0, 1})
+                {
+                    Variable candidate_variable = position;
+                    Assignment<int> assignment;
+                    assignment.assign(1 - position, fixed);
+                    SupportMask mask;
+                    batch_support(c, assignment, candidate_variable, candidates, mask);
+                    for (std::size_t i = 0; i < candidates.size(); i++)
+                    {
+                        Assignment<int> single = assignment;
+                        single.assign(candidate_variable, candidates[i]);
+                        support_ok &= is_supported(mask, i) == c.is_satisfied(single);
+                    }
+                }
+        test_ok &= check(support_ok, "batch_support matches is_satisfied");
+    }
+
+    // TEST 3: N-Queens with relational constraints, solved by forward checking
+    {
+        const int n = 10;
+        CSProblem<int> queens;
+        std::vector<int> columns;
+        for (int c = 0; c < n; c++) columns.push_back(c);
+        for (int i = 0; i < n; i++) queens.addVariable(i, Domain<int>(columns));
+        for (int i = 0; i < n; i++)
+            for (int j = i + 1; j < n; j++)
+            {
+                queens.addConstraint(Constraint<int>::relational(i, j, Relation::NotEqual));
+                queens.addConstraint(Constraint<int>::relational(i, j, Relation::DistanceNotEqual, j - i));
+            }
+
+        CSPSolver<int> solver(CSPSrategy::ForwardChecking);
+        std::unordered_map<Variable, int> s;
+        bool solved = solver.solve(queens) == CSPResult::SAT && queens.getSolution(&s);
+        for (int i = 0; i < n; i++)
+            for (int j = i + 1; j < n; j++)
+                solved &= s[i] != s[j] && std::abs(s[i] - s[j]) != j - i;
+        test_ok &= check(solved, "Relational 10-Queens");
+    }
+
+    // TEST 4: Arc consistency with relational constraints: coloring of a triangle with D0={1}, D1={1,2}, D2={1,2,3}
+    {
+        CSPBinaryProblem<int> triangle;
+        triangle.addVariable(0, Domain<int>({1}));
+        triangle.addVariable(1, Domain<int>({1, 2}));
+        triangle.addVariable(2, Domain<int>({1, 2, 3}));
+        triangle.addConstraint(Constraint<int>::relational(1, 0, Relation::NotEqual));
+        triangle.addConstraint(Constraint<int>::relational(2, 0, Relation::NotEqual));
+        triangle.addConstraint(Constraint<int>::relational(2, 1, Relation::NotEqual));
+
+        CSPSolver<int> solver(CSPSrategy::ArcConsistency);
+        std::unordered_map<Variable, int> s;
+        bool solved = solver.solve(triangle) == CSPResult::SAT && triangle.getSolution(&s);
+        test_ok &= check(solved && s[0] == 1 && s[1] == 2 && s[2] == 3, "Relational arc consistency");
+    }
+
+    // TEST 5: Less relation pruned by forward checking: x0 < x1 < x2 on 1..3 has a single solution
+    {
+        CSProblem<int> chain;
+        for (int v = 0; v < 3; v++) chain.addVariable(v, Domain<int>({3, 2, 1}));
+        chain.addConstraint(Constraint<int>::relational(0, 1, Relation::Less));
+        chain.addConstraint(Constraint<int>::relational(1, 2, Relation::Less));
+
+        CSPSolver<int> solver(CSPSrategy::ForwardChecking);
+        std::unordered_map<Variable, int> s;
+        bool solved = solver.solve(chain) == CSPResult::SAT && chain.getSolution(&s);
+        test_ok &= check(solved && s[0] == 1 && s[1] == 2 && s[2] == 3, "Relational forward checking on Less");
+    }
+
+    // TEST 6: Non-arithmetic values still solve through the generic checks: coloring of a triangle with strings
+    for (auto strategy: {CSPSrategy::Backtracking, CSPSrategy::ForwardChecking,
+                         CSPSrategy::BacktrackingEuristics, CSPSrategy::ArcConsistency})
+    {
+        CSPBinaryProblem<std::string> triangle;
+        triangle.addVariable(0, Domain<std::string>({"red"}));
+        triangle.addVariable(1, Domain<std::string>({"red", "green"}));
+        triangle.addVariable(2, Domain<std::string>({"red", "green", "blue"}));
+        for (auto [x, y]: {std::pair{1, 0}, std::pair{2, 0}, std::pair{2, 1}})
+            triangle.addConstraint({{x, y}, [](std::vector<std::string> v) { return v.size() < 2 || v[0] != v[1]; }});
+
+        CSPSolver<std::string> solver(strategy);
+        std::unordered_map<Variable, std::string> s;
+        bool solved = solver.solve(triangle) == CSPResult::SAT && triangle.getSolution(&s);
+        test_ok &= check(solved && s[0] == "red" && s[1] == "green" && s[2] == "blue", "String coloring strategy " + std::to_string((int)strategy));
+    }
+
+    std::cout << "All Batch Constraint Checks tests completed." << std::endl;
+
+    return test_ok ? 0: -1;
+}
@@ -0,0 +1,132 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+
+#include "../include/constraints/csp_problem.h"
+#include "../include/constraints/csp_solver.h"
+#include "test_utils.h"
+
+using namespace CSP;
+
+// Pigeonhole problem: n pigeons, n-1 holes, each pair of pigeons in different holes (always unsatisfiable)
+CSProblem<int> pigeonhole(int n)
+{
+    CSProblem<int> problem;
+    std::vector<int> holes;
+    for (int h = 1; h < n; h++) holes.push_back(h);
+
+    for (int i = 0; i < n; i++)
+        problem.addVariable(i, Domain<int>(holes));
+
+    auto different_rule = [](std::vector<int> values) -> bool
+    {
+        return values.size() < 2 || values[0] != values[1];
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            problem.addConstraint({{i, j}, different_rule});
+
+    return problem;
+}
+
+int main() {
+    std::cout << "Test Solver Limits.." << std::endl;
+
+    bool test_ok = true;
+
+    // TEST 1: Without limits an unsatisfiable problem is reported as UNSAT
+    {
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::Backtracking);
+        CSProblem<int> problem = pigeonhole(6);
+        test_ok &= check(solver.solve(problem) == CSPResult::UNSAT, "Unlimited search is UNSAT");
+        test_ok &= check(solver.getStopReason() == CSPStopReason::None, "Unlimited search has no stop reason");
+    }
+
+    // TEST 2: A node budget stops the search and reports UNKNOWN
+    {
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        CSPLimits limits;
+        limits.max_nodes = 100;
+        solver.setLimits(limits);
+        CSProblem<int> problem = pigeonhole(8);
+        test_ok &= check(solver.solve(problem) == CSPResult::UNKNOWN, "Node limit gives UNKNOWN");
+        test_ok &= check(solver.getStopReason() == CSPStopReason::NodeLimit, "Node limit stop reason");
+        test_ok &= check(solver.getVisitedNodes() <= limits.max_nodes + 1, "Node limit is respected");
+    }
+
+    // TEST 3: A time budget stops a long search
+    {
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::Backtracking);
+        CSPLimits limits;
+        limits.max_time = std::chrono::milliseconds(20);
+        solver.setLimits(limits);
+        CSProblem<int> problem = pigeonhole(12);
+        auto start = std::chrono::steady_clock::now();
+        CSPResult result = solver.solve(problem);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        test_ok &= check(result == CSPResult::UNKNOWN, "Time limit gives UNKNOWN");
+        test_ok &= check(solver.getStopReason() == CSPStopReason::TimeLimit, "Time limit stop reason");
+        test_ok &= check(elapsed.count() < 2000, "Time limit is respected");
+    }
+
+    // TEST 4: Cancellation from another thread
+    {
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::Backtracking);
+        CancellationToken token;
+        solver.setCancellationToken(&token);
+        CSProblem<int> problem = pigeonhole(12);
+
+        std::thread canceller([&token]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            token.cancel();
+        });
+        CSPResult result = solver.solve(problem);
+        canceller.join();
+
+        test_ok &= check(result == CSPResult::UNKNOWN, "Cancellation gives UNKNOWN");
+        test_ok &= check(solver.getStopReason() == CSPStopReason::Cancelled, "Cancellation stop reason");
+    }
+
+    // TEST 5: A satisfiable problem within the budget is still SAT
+    {
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        CSPLimits limits;
+        limits.max_nodes = 1000;
+        limits.max_time = std::chrono::milliseconds(1000);
+        limits.max_memory_bytes = (std::size_t)1 << 40;
+        solver.setLimits(limits);
+        CSProblem<int> sat_problem;
+        for (int i = 0; i < 4; i++) sat_problem.addVariable(i, Domain<int>({1, 2, 3, 4}));
+        for (int i = 0; i < 4; i++)
+            for (int j = i + 1; j < 4; j++)
+                sat_problem.addConstraint({{i, j}, [](std::vector<int> v) { return v.size() < 2 || v[0] != v[1]; }});
+        test_ok &= check(solver.solve(sat_problem) == CSPResult::SAT, "Limited satisfiable search is SAT");
+    }
+
+    // TEST 6: A memory budget counts the memory of the search, not the memory of the process
+    {
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        CSPLimits limits;
+        limits.max_memory_bytes = 64;
+        solver.setLimits(limits);
+        CSProblem<int> problem = pigeonhole(9);
+        test_ok &= check(solver.solve(problem) == CSPResult::UNKNOWN, "Memory limit gives UNKNOWN");
+        test_ok &= check(solver.getStopReason() == CSPStopReason::MemoryLimit, "Memory limit stop reason");
+
+        // Memory allocated outside of the search (e.g. by other solves) does not count: the memory
+        // is polled at node 16384, the search must go on until the node limit
+        std::vector<char> ballast(64 << 20, 1);
+        limits.max_memory_bytes = 1 << 20;
+        limits.max_nodes = 2 * SearchMonitor::memory_poll_interval;
+        solver.setLimits(limits);
+        CSProblem<int> other = pigeonhole(9);
+        solver.solve(other);
+        test_ok &= check(solver.getStopReason() == CSPStopReason::NodeLimit && ballast.back() == 1, "Memory of the process is not counted");
+    }
+
+    std::cout << "All Limits tests completed." << std::endl;
+
+    return test_ok ? 0: -1;
+}
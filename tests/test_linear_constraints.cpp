@@ -0,0 +1,140 @@
+#include <iostream>
+#include <vector>
+#include <type_traits>
+
+#include "../include/constraints/csp_problem.h"
+#include "../include/constraints/csp_solver.h"
+#include "test_utils.h"
+
+using namespace CSP;
+
+// Sums of floating point values depend on the order of the updates: linear constraints are integral only
+static_assert(std::is_constructible_v<LinearConstraint<int>, std::vector<Variable>, std::vector<int>, LinearRelation, int>);
+static_assert(!std::is_constructible_v<LinearConstraint<double>, std::vector<Variable>, std::vector<double>, LinearRelation, double>);
+
+// 2x - y + 3z >= 1,  x + y + z + w == 2,  x - w <= 0,  x + y <= z (as a Constraint lambda), x,y,z,w in -2..3
+CSProblem<int> mixed_problem()
+{
+    CSProblem<int> problem;
+    for (int v = 0; v < 4; v++) problem.addVariable(v, Domain<int>({-2, -1, 0, 1, 2, 3}));
+
+    problem.addLinearConstraint({{0, 1, 2}, {2, -1, 3}, LinearRelation::GreaterEqual, 1});
+    problem.addLinearConstraint(LinearConstraint<int>::sum({0, 1, 2, 3}, LinearRelation::Equal, 2));
+    problem.addLinearConstraint({{0, 3}, {1, -1}, LinearRelation::LessEqual, 0});
+    problem.addConstraint({{0, 1, 2}, [](std::vector<int> v) { return v.size() < 3 || v[0] + v[1] <= v[2]; }});
+    return problem;
+}
+
+int brute_force_solutions()
+{
+    int count = 0;
+    for (int x = -2; x <= 3; x++)
+        for (int y = -2; y <= 3; y++)
+            for (int z = -2; z <= 3; z++)
+                for (int w = -2; w <= 3; w++)
+                    if (2*x - y + 3*z >= 1 && x + y + z + w == 2 && x - w <= 0 && x + y <= z) count++;
+    return count;
+}
+
+int main() {
+    std::cout << "Test Linear Constraints.." << std::endl;
+
+    bool test_ok = true;
+
+    // TEST 1: is_satisfied on complete and partial assignments
+    {
+        LinearConstraint<int> c({0, 1, 2}, {1, 1, -1}, LinearRelation::LessEqual, 0);
+        test_ok &= check(c.is_satisfied(Assignment<int>({{0, 1}, {1, 2}, {2, 3}})), "1 + 2 <= 3");
+        test_ok &= check(!c.is_satisfied(Assignment<int>({{0, 2}, {1, 2}, {2, 3}})), "2 + 2 > 3");
+        test_ok &= check(c.is_satisfied(Assignment<int>({{0, 9}, {1, 9}})), "Partial assignment is not evaluated");
+    }
+
+    // TEST 2: Every strategy enumerates exactly the solutions found by brute force
+    const int expected = brute_force_solutions();
+    for (auto strategy: {CSPSrategy::Backtracking, CSPSrategy::ForwardChecking, CSPSrategy::BacktrackingEuristics})
+    {
+        CSPSolver<int> solver(strategy);
+        CSProblem<int> problem = mixed_problem();
+        int solutions = 0;
+        for (CSPResult result = solver.solve(problem); result == CSPResult::SAT; result = solver.resume(problem))
+        {
+            std::unordered_map<Variable, int> s;
+            problem.getSolution(&s);
+            bool valid = 2*s[0] - s[1] + 3*s[2] >= 1 && s[0] + s[1] + s[2] + s[3] == 2 && s[0] - s[3] <= 0 && s[0] + s[1] <= s[2];
+            solutions += valid ? 1 : 1000;
+        }
+        test_ok &= check(solutions == expected, "All " + std::to_string(expected) + " solutions strategy " + std::to_string((int)strategy));
+    }
+
+    // TEST 3: Bounds propagation proves infeasibility without searching
+    {
+        CSProblem<int> problem;
+        std::vector<Variable> items;
+        for (int i = 0; i < 30; i++)
+        {
+            problem.addVariable(i, Domain<int>({0, 1}));
+            items.push_back(i);
+        }
+        problem.addLinearConstraint(LinearConstraint<int>::sum(items, LinearRelation::GreaterEqual, 31));
+
+        CSPSolver<int> solver(CSPSrategy::Backtracking);
+        test_ok &= check(solver.solve(problem) == CSPResult::UNSAT && solver.getVisitedNodes() == 0, "Infeasible sum detected at the root");
+    }
+
+    // TEST 4: Knapsack with a capacity and a target value is pruned by forward checking
+    {
+        const std::vector<int> weights = {12, 7, 11, 8, 9, 6, 14, 5, 10, 13, 4, 15};
+        const std::vector<int> values = {24, 13, 23, 15, 16, 11, 28, 9, 19, 26, 7, 29};
+        CSProblem<int> problem;
+        std::vector<Variable> items;
+        for (int i = 0; i < (int)weights.size(); i++)
+        {
+            problem.addVariable(i, Domain<int>({1, 0}));
+            items.push_back(i);
+        }
+        problem.addLinearConstraint({items, weights, LinearRelation::LessEqual, 50});
+        problem.addLinearConstraint({items, values, LinearRelation::GreaterEqual, 100});
+
+        CSPSolver<int> solver(CSPSrategy::ForwardChecking);
+        std::unordered_map<Variable, int> s;
+        test_ok &= check(solver.solve(problem) == CSPResult::SAT, "Knapsack is SAT");
+        problem.getSolution(&s);
+        int weight = 0, value = 0;
+        for (int i = 0; i < (int)weights.size(); i++)
+        {
+            weight += weights[i] * s[i];
+            value += values[i] * s[i];
+        }
+        test_ok &= check(weight <= 50 && value >= 100, "Knapsack solution");
+    }
+
+    // TEST 5: A variable repeated in the sum counts once per occurrence: x + x == 4 on 0..3
+    for (auto strategy: {CSPSrategy::Backtracking, CSPSrategy::ForwardChecking, CSPSrategy::BacktrackingEuristics})
+    {
+        CSProblem<int> problem;
+        problem.addVariable(0, Domain<int>({0, 1, 2, 3}));
+        problem.addLinearConstraint({{0, 0}, {1, 1}, LinearRelation::Equal, 4});
+
+        CSPSolver<int> solver(strategy);
+        std::unordered_map<Variable, int> s;
+        bool solved = solver.solve(problem) == CSPResult::SAT && problem.getSolution(&s) && s[0] == 2;
+        test_ok &= check(solved && solver.resume(problem) == CSPResult::UNSAT, "Repeated variable strategy " + std::to_string((int)strategy));
+    }
+
+    // TEST 6: Arc consistency does not enforce linear constraints and does not claim SAT
+    {
+        CSPBinaryProblem<int> problem;
+        problem.addVariable(0, Domain<int>({1, 2}));
+        problem.addVariable(1, Domain<int>({1, 2}));
+        problem.addConstraint({{0, 1}, [](std::vector<int> v) { return v.size() < 2 || v[0] == v[1]; }});
+        problem.addLinearConstraint(LinearConstraint<int>::sum({0, 1}, LinearRelation::GreaterEqual, 10));
+
+        CSPSolver<int> solver(CSPSrategy::ArcConsistency);
+        std::unordered_map<Variable, int> s;
+        test_ok &= check(solver.solve(problem) == CSPResult::UNKNOWN && !problem.getSolution(&s), "Arc consistency with linear constraints is UNKNOWN");
+    }
+
+    std::cout << "All Linear Constraints tests completed." << std::endl;
+
+    return test_ok ? 0: -1;
+}
@@ -0,0 +1,249 @@
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include <unordered_map>
+
+#include "../include/constraints/csp_problem.h"
+#include "../include/constraints/csp_solver.h"
+#include "test_utils.h"
+
+using namespace CSP;
+
+// N-Queens: variable i is the column of the queen on row i
+CSProblem<int> queens(int n)
+{
+    CSProblem<int> problem;
+    std::vector<int> columns;
+    for (int c = 0; c < n; c++) columns.push_back(c);
+
+    for (int i = 0; i < n; i++)
+        problem.addVariable(i, Domain<int>(columns));
+
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+        {
+            int distance = j - i;
+            problem.addConstraint({{i, j}, [distance](std::vector<int> values) -> bool
+            {
+                if (values.size() < 2) return true;
+                return values[0] != values[1] && std::abs(values[0] - values[1]) != distance;
+            }});
+        }
+
+    return problem;
+}
+
+bool is_queens_solution(CSProblem<int>& problem, int n)
+{
+    std::unordered_map<Variable, int> solution;
+    if (!problem.getSolution(&solution) || (int)solution.size() != n) return false;
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            if (solution[i] == solution[j] || std::abs(solution[i] - solution[j]) == j - i) return false;
+    return true;
+}
+
+int main() {
+    std::cout << "Test Search Engine.." << std::endl;
+
+    bool test_ok = true;
+
+    // TEST 1: A very deep search does not overflow the stack
+    {
+        const int n = 200000;
+        CSProblem<int> chain;
+        for (int i = 0; i < n; i++) chain.addVariable(i, Domain<int>({0, 1}));
+        for (int i = 0; i + 1 < n; i++)
+            chain.addConstraint({{i, i + 1}, [](std::vector<int> values) { return values.size() < 2 || values[0] != values[1]; }});
+
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        std::unordered_map<Variable, int> solution;
+        test_ok &= check(solver.solve(chain) == CSPResult::SAT, "Deep chain is SAT");
+        chain.getSolution(&solution);
+        test_ok &= check(solution[n - 1] == (n - 1) % 2, "Deep chain solution");
+    }
+
+    // TEST 2: Every strategy built on the engine solves N-Queens
+    for (auto strategy: {CSPSolver<int>::CSPSrategy::Backtracking,
+                         CSPSolver<int>::CSPSrategy::ForwardChecking,
+                         CSPSolver<int>::CSPSrategy::BacktrackingEuristics})
+    {
+        CSPSolver<int> solver(strategy);
+        CSProblem<int> problem = queens(8);
+        test_ok &= check(solver.solve(problem) == CSPResult::SAT && is_queens_solution(problem, 8), "8-Queens strategy " + std::to_string((int)strategy));
+
+        CSProblem<int> unsat = queens(3);
+        test_ok &= check(solver.solve(unsat) == CSPResult::UNSAT, "3-Queens strategy " + std::to_string((int)strategy));
+    }
+
+    // TEST 3: Suspend with a small node budget and resume until the search completes
+    {
+        CSPSolver<int> reference_solver(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        CSProblem<int> reference = queens(10);
+        reference_solver.solve(reference);
+        std::unordered_map<Variable, int> expected, solution;
+        reference.getSolution(&expected);
+
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        CSPLimits limits;
+        limits.max_nodes = 5;
+        solver.setLimits(limits);
+        CSProblem<int> problem = queens(10);
+
+        int suspensions = 0;
+        CSPResult result = solver.solve(problem);
+        while (result == CSPResult::UNKNOWN && suspensions < 10000)
+        {
+            suspensions++;
+            result = solver.resume(problem);
+        }
+        problem.getSolution(&solution);
+
+        test_ok &= check(suspensions > 1, "Search has been suspended");
+        test_ok &= check(result == CSPResult::SAT && solution == expected, "Resumed search finds the same solution");
+        test_ok &= check(solver.getVisitedNodes() == reference_solver.getVisitedNodes(), "Resumed search visits the same nodes");
+    }
+
+    // TEST 4: Checkpoint an in-progress search and continue it in another solver
+    {
+        const std::string path = "search_engine_checkpoint.txt";
+
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::Backtracking);
+        CSPLimits limits;
+        limits.max_nodes = 20;
+        solver.setLimits(limits);
+        CSProblem<int> problem = queens(8);
+        test_ok &= check(solver.solve(problem) == CSPResult::UNKNOWN, "Search stopped before the checkpoint");
+        test_ok &= check(solver.saveCheckpoint(path, problem), "Checkpoint saved");
+
+        CSPSolver<int> restored_solver(CSPSolver<int>::CSPSrategy::Backtracking);
+        CSProblem<int> restored = queens(8);
+        test_ok &= check(restored_solver.loadCheckpoint(path, restored), "Checkpoint loaded");
+        test_ok &= check(restored_solver.resume(restored) == CSPResult::SAT && is_queens_solution(restored, 8), "Restored search is SAT");
+
+        CSPSolver<int> other_strategy(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        CSProblem<int> other = queens(8);
+        test_ok &= check(!other_strategy.loadCheckpoint(path, other), "Checkpoint of another strategy is rejected");
+
+        std::remove(path.c_str());
+    }
+
+    // TEST 5: Resuming after a solution enumerates the next one (92 solutions for 8-Queens)
+    {
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        CSProblem<int> problem = queens(8);
+        int solutions = 0;
+        for (CSPResult result = solver.solve(problem); result == CSPResult::SAT; result = solver.resume(problem))
+            solutions += is_queens_solution(problem, 8);
+        test_ok &= check(solutions == 92, "All 8-Queens solutions enumerated");
+    }
+
+    // TEST 6: Floating point values survive a checkpoint exactly
+    {
+        const std::string path = "search_engine_checkpoint_double.txt";
+        const std::vector<double> values = {0.1234567891, 1.0000001, 2.5};
+        auto build = [&values]() {
+            CSProblem<double> problem;
+            for (int i = 0; i < 3; i++) problem.addVariable(i, Domain<double>(values));
+            for (int i = 0; i < 3; i++)
+                for (int j = i + 1; j < 3; j++)
+                    problem.addConstraint({{i, j}, [](std::vector<double> v) { return v.size() < 2 || v[0] != v[1]; }});
+            return problem;
+        };
+
+        CSPSolver<double> solver(CSPSolver<double>::CSPSrategy::Backtracking);
+        CSPLimits limits;
+        limits.max_nodes = 2;
+        solver.setLimits(limits);
+        CSProblem<double> problem = build();
+        bool saved = solver.solve(problem) == CSPResult::UNKNOWN && solver.saveCheckpoint(path, problem);
+
+        CSPSolver<double> restored_solver(CSPSolver<double>::CSPSrategy::Backtracking);
+        CSProblem<double> restored = build();
+        std::unordered_map<Variable, double> solution;
+        bool resumed = saved && restored_solver.loadCheckpoint(path, restored) && restored_solver.resume(restored) == CSPResult::SAT;
+        resumed = resumed && restored.getSolution(&solution) && solution.size() == 3;
+        for (auto& [variable, value]: solution)
+            resumed &= std::find(values.begin(), values.end(), value) != values.end();
+        test_ok &= check(resumed, "Checkpoint keeps floating point values");
+
+        std::remove(path.c_str());
+    }
+
+    // TEST 7: Malformed checkpoints are rejected without throwing
+    {
+        const std::string path = "search_engine_checkpoint_malformed.txt";
+        const std::string contents[] = {
+            "algoai-csp-checkpoint 1\noptions 0 0\nstatus 7\n",
+            "algoai-csp-checkpoint 1\noptions 0 0\nstatus 2\nvariables 4\n0 1 2 3 \nassigned 1\nrow 0\n",
+            "algoai-csp-checkpoint 1\noptions 0 0\nstatus 2\nvariables 4\n0 1 2 3 \nassigned 9\n",
+            "algoai-csp-checkpoint 1\noptions 0 0\nstatus 2\nvariables 4\n0 1 2 3 \nassigned 0\ndomains\n1 5\n4 0 1 2\n",
+            "algoai-csp-checkpoint 1\noptions 0 0\nstatus 2\nvariables 4\n0 1 2 3 \nassigned 0\nvalues\n",
+            "algoai-csp-checkpoint 1\noptions 0 0\nstatus 2\nvariables 4\n0 1 2 3 \nassigned 0\ndomains\n99999999999 1\n",
+            "algoai-csp-checkpoint 1\noptions 0 0\nstatus 2\nvariables 4\n0 1 2 3 \nassigned 0\ndomains\n1 0\n1 0\n1 0\n1 0\nstack 99999999999\n",
+            "algoai-csp-checkpoint 1\noptions 0 0\nstatus 2\nvariables 4\n0 1 2 3 \nassigned 0\ndomains\n1 0\n1 0\n1 0\n1 0\nstack 1\n0 0 3\ntrail 99999999999\n",
+            "algoai-csp-checkpoint 1\noptions 0 0\nstatus 2\nvariables 4\n0 1 2 3 \nassigned 0\ndomains\n1 0\n1 0\n1 0\n1 0\nstack 1\n0 0 3\ntrail 0\n"
+        };
+
+        // A failed load leaves the problem as it was
+        bool rejected = true, unchanged = true;
+        for (const std::string& content: contents)
+        {
+            std::ofstream(path) << content;
+            CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::Backtracking);
+            CSProblem<int> problem = queens(4);
+            problem.assignValue(1, 3);
+            rejected &= !solver.loadCheckpoint(path, problem);
+            unchanged &= problem.isAssigned(1) && problem.getValue(1) == 3 && !problem.isAssigned(0);
+            for (int v = 0; v < 4; v++) unchanged &= problem.getDomain(v).get_values().size() == 4;
+        }
+        test_ok &= check(rejected, "Malformed checkpoints rejected");
+        test_ok &= check(unchanged, "Failed load leaves the problem unchanged");
+
+        std::remove(path.c_str());
+    }
+
+    // TEST 8: Checkpoint from a copy of the solved problem, after the original is gone
+    {
+        const std::string path = "search_engine_checkpoint_copy.txt";
+
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        CSPLimits limits;
+        limits.max_nodes = 10;
+        solver.setLimits(limits);
+        CSProblem<int> copy;
+        bool stopped = false;
+        {
+            CSProblem<int> original = queens(8);
+            stopped = solver.solve(original) == CSPResult::UNKNOWN;
+            copy = original;
+        }
+        CSProblem<int> unrelated = queens(8);
+        test_ok &= check(stopped && !solver.saveCheckpoint(path, unrelated), "Checkpoint of another problem state is rejected");
+        test_ok &= check(solver.saveCheckpoint(path, copy), "Checkpoint saved from a copy");
+
+        CSPSolver<int> restored_solver(CSPSolver<int>::CSPSrategy::ForwardChecking);
+        CSProblem<int> restored = queens(8);
+        test_ok &= check(restored_solver.loadCheckpoint(path, restored) && restored_solver.resume(restored) == CSPResult::SAT
+                         && is_queens_solution(restored, 8), "Search restored from a copy is SAT");
+
+        std::remove(path.c_str());
+    }
+
+    // TEST 9: Resuming without a search in progress is UNKNOWN, not UNSAT
+    {
+        CSProblem<int> single;
+        single.addVariable(0, Domain<int>({1, 2}));
+
+        CSPSolver<int> solver(CSPSolver<int>::CSPSrategy::Backtracking);
+        test_ok &= check(solver.resume(single) == CSPResult::UNKNOWN, "Resume before solve is UNKNOWN");
+        test_ok &= check(solver.solve(single) == CSPResult::SAT, "Solve after resume is SAT");
+    }
+
+    std::cout << "All Search Engine tests completed." << std::endl;
+
+    return test_ok ? 0: -1;
+}
@@ -0,0 +1,139 @@
+#include <iostream>
+#include <array>
+#include <cstdlib>
+
+#include "../include/constraints/csp_static_models.h"
+#include "../include/constraints/csp_static_solver.h"
+#include "../include/constraints/csp_solver.h"
+#include "test_utils.h"
+
+using namespace CSP;
+
+// The constraint graph is built at compile time
+static_assert(CSPStaticSolver<StaticSudoku>::adjacency.offsets[81] == 1620);
+static_assert(CSPStaticSolver<StaticSudoku>::adjacency.offsets[1] == 20);
+static_assert(StaticDomain<9>::full().count() == 9);
+static_assert(StaticDomain<70>::above(3).count() == 66);
+static_assert(StaticDomain<70>::below(66).count() == 66);
+
+// Same sudoku of test_sudoku_backtracking (row-major, 0 = empty)
+constexpr std::array<int, 81> clues = {
+    0,0,2, 0,0,7, 0,0,0,
+    0,6,0, 9,0,3, 4,0,0,
+    0,9,0, 2,5,0, 0,0,3,
+    0,0,0, 4,0,0, 1,0,0,
+    7,3,0, 0,6,0, 0,0,0,
+    0,0,9, 5,3,0, 0,6,0,
+    0,0,6, 3,4,0, 0,7,0,
+    8,0,0, 0,0,0, 0,0,9,
+    0,0,0, 0,0,0, 0,5,0
+};
+
+constexpr std::array<int, 81> expected = {
+    3,4,2, 6,8,7, 9,1,5,
+    5,6,8, 9,1,3, 4,2,7,
+    1,9,7, 2,5,4, 6,8,3,
+    6,8,5, 4,7,9, 1,3,2,
+    7,3,4, 1,6,2, 5,9,8,
+    2,1,9, 5,3,8, 7,6,4,
+    9,2,6, 3,4,5, 8,7,1,
+    8,5,1, 7,2,6, 3,4,9,
+    4,7,3, 8,9,1, 2,5,6
+};
+
+// x0 and x1 on 0..3 with |x0 - x1| != -1, which always holds, and |x1 - x2| != 3
+struct NegativeDistance
+{
+    static constexpr std::size_t variables = 3;
+    static constexpr std::size_t domain_size = 4;
+    static constexpr int min_value = 0;
+    static constexpr std::array<StaticConstraint, 2> constraints = {{
+        {0, 1, Relation::DistanceNotEqual, -1},
+        {1, 2, Relation::DistanceNotEqual, 3}
+    }};
+};
+
+template <std::size_t N>
+bool is_queens_solution(const std::array<int, N>& solution)
+{
+    for (std::size_t i = 0; i < N; i++)
+        for (std::size_t j = i + 1; j < N; j++)
+            if (solution[i] == solution[j] || std::abs(solution[i] - solution[j]) == (int)(j - i)) return false;
+    return true;
+}
+
+int main() {
+    std::cout << "Test Static Solver.." << std::endl;
+
+    bool test_ok = true;
+
+    const CSPSrategy strategies[] = {CSPSrategy::Backtracking, CSPSrategy::ForwardChecking,
+                                     CSPSrategy::BacktrackingEuristics, CSPSrategy::ArcConsistency};
+
+    for (CSPSrategy strategy: strategies)
+    {
+        std::string name = " strategy " + std::to_string((int)strategy);
+
+        // TEST 1: Sudoku
+        CSPStaticProblem<StaticSudoku> sudoku;
+        for (std::size_t v = 0; v < 81; v++)
+            if (clues[v]) sudoku.assignValue(v, clues[v]);
+
+        CSPStaticSolver<StaticSudoku> solver(strategy);
+        std::array<int, 81> solution;
+        test_ok &= check(solver.solve(sudoku) == CSPResult::SAT, "Sudoku is SAT" + name);
+        test_ok &= check(sudoku.getSolution(&solution) && solution == expected, "Sudoku solution" + name);
+
+        // TEST 2: N-Queens
+        CSPStaticProblem<StaticQueens<12>> queens;
+        CSPStaticSolver<StaticQueens<12>> queens_solver(strategy);
+        std::array<int, 12> queens_solution;
+        test_ok &= check(queens_solver.solve(queens) == CSPResult::SAT, "12-Queens is SAT" + name);
+        test_ok &= check(queens.getSolution(&queens_solution) && is_queens_solution(queens_solution), "12-Queens solution" + name);
+
+        CSPStaticProblem<StaticQueens<3>> unsat;
+        CSPStaticSolver<StaticQueens<3>> unsat_solver(strategy);
+        test_ok &= check(unsat_solver.solve(unsat) == CSPResult::UNSAT, "3-Queens is UNSAT" + name);
+
+        // TEST 3: Conflicting clues
+        CSPStaticProblem<StaticSudoku> wrong;
+        wrong.assignValue(0, 5);
+        wrong.assignValue(1, 5);
+        test_ok &= check(solver.solve(wrong) == CSPResult::UNSAT, "Conflicting clues are UNSAT" + name);
+
+        // The dynamic solver agrees on conflicting clues (arc consistency only filters the domains)
+        if (strategy != CSPSrategy::ArcConsistency)
+        {
+            CSProblem<int> clashing;
+            for (int v = 0; v < 3; v++) clashing.addVariable(v, Domain<int>({1, 2, 3}));
+            clashing.addConstraint({{0, 1}, [](std::vector<int> v) { return v.size() < 2 || v[0] != v[1]; }});
+            clashing.assignValue(0, 1);
+            clashing.assignValue(1, 1);
+            CSPSolver<int> dynamic_solver(strategy);
+            test_ok &= check(dynamic_solver.solve(clashing) == CSPResult::UNSAT, "Conflicting clues are UNSAT dynamic" + name);
+        }
+
+        // TEST 4: A negative distance prunes nothing
+        CSPStaticProblem<NegativeDistance> distance;
+        distance.assignValue(0, 0);
+        distance.assignValue(1, 1);
+        CSPStaticSolver<NegativeDistance> distance_solver(strategy);
+        std::array<int, 3> distance_solution;
+        test_ok &= check(distance_solver.solve(distance) == CSPResult::SAT && distance.getSolution(&distance_solution)
+                         && distance_solution == std::array<int, 3>{0, 1, 0}, "Negative distance" + name);
+    }
+
+    // TEST 5: Limits are honoured
+    {
+        CSPStaticProblem<StaticQueens<30>> queens;
+        CSPStaticSolver<StaticQueens<30>> solver(CSPSrategy::Backtracking);
+        CSPLimits limits;
+        limits.max_nodes = 10;
+        solver.setLimits(limits);
+        test_ok &= check(solver.solve(queens) == CSPResult::UNKNOWN, "Node limit gives UNKNOWN");
+    }
+
+    std::cout << "All Static Solver tests completed." << std::endl;
+
+    return test_ok ? 0: -1;
+}
@@ -144,6 +144,7 @@ int main() {
     printSolution(solution);
     // Check solution
     bool solution_ok = checkTestSolution(solution);
+    bool test_ok = solution_ok;
     std::cout << "Sudoku test result with backtracking algorithm: " << (solution_ok? "passed":"failed") << std::endl;
 
     // TEST 1: Backtracking Forrward Checking Strategy
@@ -157,7 +158,8 @@ int main() {
     printSolution(solution);
     // Check solution
     solution_ok = checkTestSolution(solution);
-    std::cout << "Sudoku test result with backtracking algorithm: " << (solution_ok? "passed":"failed") << std::endl;
+    test_ok &= solution_ok;
+    std::cout << "Sudoku test result with forward checking algorithm: " << (solution_ok? "passed":"failed") << std::endl;
 
-    return solution_ok;
+    return test_ok ? 0: -1;
 }
\ No newline at end of file
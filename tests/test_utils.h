@@ -0,0 +1,11 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+// Print the outcome of a named check and return it, to be and-ed into test_ok
+inline bool check(bool condition, const std::string& name)
+{
+    std::cout << name << ": " << (condition ? "passed" : "failed") << std::endl;
+    return condition;
+}